@@ -8,6 +8,7 @@
 #include <cstring>
 #include <optional>
 #include <utility>
+#include <vector>
 
 
 namespace simsycl::detail {
@@ -101,4 +102,35 @@ class allocation {
     void *m_ptr = nullptr;
 };
 
+// The local memory slot shared by all copies of a local_accessor, which points to the allocation of the current group.
+// While multiple threads execute groups of the same nd_range kernel concurrently, the slot cannot point to the current
+// group's allocation. Instead, each thread binds its allocations to the indices of the slots, and accessors resolve
+// them through `get_local_memory_allocation`.
+struct local_memory_slot {
+    void *allocation = nullptr;
+    // position among the local memory requirements of the command group, which thread-local bindings are indexed by
+    size_t index = 0;
+};
+
+extern thread_local const std::vector<void *> *g_local_memory_bindings;
+
+inline void *get_local_memory_allocation(const local_memory_slot *slot) {
+    if(g_local_memory_bindings != nullptr) [[unlikely]] { return (*g_local_memory_bindings)[slot->index]; }
+    return slot->allocation;
+}
+
+class local_memory_binding_scope {
+  public:
+    explicit local_memory_binding_scope(const std::vector<void *> *bindings)
+        : m_bindings_before(std::exchange(g_local_memory_bindings, bindings)) {}
+    local_memory_binding_scope(const local_memory_binding_scope &) = delete;
+    local_memory_binding_scope(local_memory_binding_scope &&) = delete;
+    local_memory_binding_scope &operator=(const local_memory_binding_scope &) = delete;
+    local_memory_binding_scope &operator=(local_memory_binding_scope &&) = delete;
+    ~local_memory_binding_scope() { g_local_memory_bindings = m_bindings_before; }
+
+  private:
+    const std::vector<void *> *m_bindings_before;
+};
+
 } // namespace simsycl::detail
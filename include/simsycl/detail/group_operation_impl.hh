@@ -1,16 +1,22 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <optional>
+#include <span>
 #include <type_traits>
 #include <typeindex>
+#include <typeinfo>
+#include <utility>
 #include <vector>
 
 #include "allocation.hh"
 #include "check.hh"
 
+#include "../schedule.hh"
 #include "../sycl/concepts.hh" // IWYU pragma: keep
 #include "../sycl/enums.hh"
 #include "../sycl/group.hh"
@@ -68,52 +74,118 @@ enum class group_operation_id {
     exit,
 };
 
-// additional data required to implement and check correct use for some group operations
+// Bump allocator for the per-operation data of one group or sub-group instance. All objects are released at once when
+// the instance is reset for the next group, and memory is retained across resets so that group operations do not need
+// to allocate once the arena has grown to fit the operations of one group.
+class group_operation_arena {
+  public:
+    group_operation_arena() = default;
+    group_operation_arena(const group_operation_arena &) = delete;
+    group_operation_arena(group_operation_arena &&other) noexcept { swap(other); }
+    group_operation_arena &operator=(const group_operation_arena &) = delete;
+
+    group_operation_arena &operator=(group_operation_arena &&other) noexcept {
+        reset();
+        swap(other);
+        return *this;
+    }
+
+    ~group_operation_arena() { reset(); }
+
+    template<typename T, typename... Args>
+    T *create(Args &&...args) {
+        auto *const object = new(allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        if constexpr(!std::is_trivially_destructible_v<T>) {
+            m_destructors.push_back({[](void *ptr) { static_cast<T *>(ptr)->~T(); }, object});
+        }
+        return object;
+    }
+
+    template<typename T>
+    std::span<T> create_array(const size_t size) {
+        static_assert(std::is_trivially_destructible_v<T>);
+        auto *const first = static_cast<T *>(allocate(size * sizeof(T), alignof(T)));
+        std::uninitialized_value_construct_n(first, size);
+        return std::span<T>(first, size);
+    }
+
+    // Destroy all objects and make their memory available for re-use.
+    void reset();
+
+  private:
+    struct destructor {
+        void (*destroy)(void *);
+        void *object;
+    };
 
-struct group_per_operation_data {
-    // non-templated base class for specialized per-operation data
-    virtual ~group_per_operation_data() = default;
+    std::vector<std::pair<std::unique_ptr<std::byte[]>, size_t>> m_blocks; // (memory, size)
+    size_t m_current_block = 0;
+    size_t m_current_offset = 0;
+    std::vector<destructor> m_destructors;
+
+    void *allocate(size_t size, size_t alignment);
+
+    void swap(group_operation_arena &other) noexcept {
+        std::swap(m_blocks, other.m_blocks);
+        std::swap(m_current_block, other.m_current_block);
+        std::swap(m_current_offset, other.m_current_offset);
+        std::swap(m_destructors, other.m_destructors);
+    }
 };
 
+// additional data required to implement and check correct use for some group operations, allocated from the
+// group_operation_arena of the group instance
+
+// for operations without additional data
+struct group_no_operation_data {};
+
 template<typename T>
-struct group_broadcast_data : group_per_operation_data {
+struct group_broadcast_data {
     size_t local_linear_id = 0;
     std::type_index type = std::type_index(typeid(void));
-    std::vector<T> values;
+    std::span<T> values;
+    group_broadcast_data(group_operation_arena &arena, size_t num_work_items, size_t local_linear_id)
+        : local_linear_id(local_linear_id), type(typeid(T)), values(arena.create_array<T>(num_work_items)) {}
 };
-struct group_barrier_data : group_per_operation_data {
+struct group_barrier_data {
     sycl::memory_scope fence_scope;
+    explicit group_barrier_data(sycl::memory_scope fence_scope) : fence_scope(fence_scope) {}
 };
 template<typename Ptr>
-struct group_joint_bool_op_data : group_per_operation_data {
+struct group_joint_bool_op_data {
     Ptr first;
     Ptr last;
     bool result;
     group_joint_bool_op_data(Ptr first, Ptr last, bool result) : first(first), last(last), result(result) {}
 };
-struct group_bool_data : group_per_operation_data {
-    std::vector<bool> values;
-    group_bool_data(size_t num_work_items) : values(num_work_items) {}
+struct group_bool_data {
+    std::span<bool> values;
+    bool result = false;
+    group_bool_data(group_operation_arena &arena, size_t num_work_items)
+        : values(arena.create_array<bool>(num_work_items)) {}
 };
 template<typename T>
-struct group_shift_data : group_per_operation_data {
-    std::vector<T> values;
+struct group_shift_data {
+    std::span<T> values;
     size_t delta;
-    group_shift_data(size_t num_work_items, size_t delta) : values(num_work_items), delta(delta) {}
+    group_shift_data(group_operation_arena &arena, size_t num_work_items, size_t delta)
+        : values(arena.create_array<T>(num_work_items)), delta(delta) {}
 };
 template<typename T>
-struct group_permute_data : group_per_operation_data {
-    std::vector<T> values;
+struct group_permute_data {
+    std::span<T> values;
     size_t mask;
-    group_permute_data(size_t num_work_items, size_t mask) : values(num_work_items), mask(mask) {}
+    group_permute_data(group_operation_arena &arena, size_t num_work_items, size_t mask)
+        : values(arena.create_array<T>(num_work_items)), mask(mask) {}
 };
 template<typename T>
-struct group_select_data : group_per_operation_data {
-    std::vector<T> values;
-    group_select_data(size_t num_work_items) : values(num_work_items) {}
+struct group_select_data {
+    std::span<T> values;
+    group_select_data(group_operation_arena &arena, size_t num_work_items)
+        : values(arena.create_array<T>(num_work_items)) {}
 };
 template<typename Ptr, typename T>
-struct group_joint_reduce_data : group_per_operation_data {
+struct group_joint_reduce_data {
     Ptr first;
     Ptr last;
     std::optional<T> init;
@@ -122,44 +194,132 @@ struct group_joint_reduce_data : group_per_operation_data {
         : first(first), last(last), init(init), result(result) {}
 };
 template<typename T>
-struct group_reduce_data : group_per_operation_data {
+struct group_reduce_data {
     std::optional<T> init;
-    std::vector<T> values;
-    group_reduce_data(size_t num_work_items, std::optional<T> init) : init(init), values(num_work_items) {}
+    std::span<T> values;
+    T result{};
+    group_reduce_data(group_operation_arena &arena, size_t num_work_items, std::optional<T> init)
+        : init(init), values(arena.create_array<T>(num_work_items)) {}
 };
 template<typename Ptr, typename T>
-struct group_joint_scan_data : group_per_operation_data {
+struct group_joint_scan_data {
     Ptr first;
     Ptr last;
     std::optional<T> init;
-    std::vector<T> results;
-    group_joint_scan_data(Ptr first, Ptr last, std::optional<T> init, const std::vector<T> &results)
-        : first(first), last(last), init(init), results(results) {}
+    std::span<T> results;
+    group_joint_scan_data(group_operation_arena &arena, Ptr first, Ptr last, std::optional<T> init)
+        : first(first), last(last), init(init), results(arena.create_array<T>(std::distance(first, last))) {}
 };
 template<typename T>
-struct group_scan_data : group_per_operation_data {
+struct group_scan_data {
     std::optional<T> init;
-    std::vector<T> values;
-    group_scan_data(size_t num_work_items, std::optional<T> init) : init(init), values(num_work_items) {}
+    std::span<T> values; // replaced by the results once all work items have reached the operation
+    group_scan_data(group_operation_arena &arena, size_t num_work_items, std::optional<T> init)
+        : init(init), values(arena.create_array<T>(num_work_items)) {}
 };
 
+// identifies the type of per-operation data by address, which is cheaper than RTTI
+template<typename PerOpT>
+inline constexpr char group_per_operation_type_tag = 0;
+
 struct group_operation_data {
     group_operation_id id;
     size_t expected_num_work_items;
     size_t num_work_items_participating;
+    size_t num_work_items_departed = 0;
     bool valid;
-    std::unique_ptr<group_per_operation_data> per_op_data;
+    const void *per_op_type = &group_per_operation_type_tag<group_no_operation_data>;
+    void *per_op_data = nullptr;
+};
+
+template<typename PerOpT>
+PerOpT &get_per_operation_data(const group_operation_data &op) {
+    if constexpr(std::is_same_v<PerOpT, group_no_operation_data>) {
+        // operations without data (like the implicit exit) may meet any other operation when work items diverge
+        static group_no_operation_data no_data;
+        return no_data;
+    } else {
+        const bool type_matches = op.per_op_type == &group_per_operation_type_tag<PerOpT>;
+        SIMSYCL_CHECK_MSG(type_matches, "group operation data type mismatch");
+        // reinterpreting data of another type would be undefined behavior, so we throw even if checks do not
+        if(!type_matches) throw std::bad_cast();
+        return *static_cast<PerOpT *>(op.per_op_data);
+    }
+}
+
+// Testing aid: while enabled, every group operation history additionally records the ids of all operations performed
+// since its last reset, including the retired ones.
+void set_group_operation_id_recording(bool enable);
+
+// The operations of a group instance that not all work items have departed from yet, indexed by the number of
+// operations the group has performed before. Operations are retired in order as soon as every participant has left
+// them, so a ring buffer holds only the few operations between the slowest and the fastest work item.
+//
+// Per-operation data is allocated from one of two arenas. A new operation switches to the other arena whenever all
+// operations allocated from it have been retired, which recycles arena memory without tracking individual objects.
+class group_operation_history {
+  public:
+    // Index of the oldest operation that has not been retired.
+    size_t begin_index() const { return m_begin; }
+
+    // Number of operations the group has performed so far.
+    size_t end_index() const { return m_end; }
+
+    group_operation_data &operator[](const size_t index) { return m_ring[index & (m_ring.size() - 1)].op; }
+    const group_operation_data &operator[](const size_t index) const {
+        return m_ring[index & (m_ring.size() - 1)].op;
+    }
+
+    // Arena to allocate the per-operation data of the next operation from, which must be appended right after.
+    group_operation_arena &get_next_arena() {
+        const auto other_arena = 1 - m_current_arena;
+        if(m_num_live_operations[other_arena] == 0) {
+            m_arenas[other_arena].reset();
+            m_current_arena = other_arena;
+        }
+        return m_arenas[m_current_arena];
+    }
+
+    // Ids of all operations since the last reset if recorded, see set_group_operation_id_recording.
+    const std::vector<group_operation_id> &recorded_ids() const { return m_recorded_ids; }
+
+    void push_back(const group_operation_data &op);
+
+    // Record that one participant has left the operation at `index`, and retire all leading operations that every
+    // participant has left.
+    void depart(size_t index, size_t num_work_items = 1);
+
+    // Start over with an empty history, retaining allocations.
+    void reset();
+
+  private:
+    struct entry {
+        group_operation_data op;
+        size_t arena;
+    };
+
+    std::vector<entry> m_ring; // size is zero or a power of two
+    size_t m_begin = 0;
+    size_t m_end = 0;
+    group_operation_arena m_arenas[2];
+    size_t m_num_live_operations[2] = {0, 0};
+    size_t m_current_arena = 0;
+    std::vector<group_operation_id> m_recorded_ids;
 };
 
 // group and sub-group impl
 
 struct group_instance {
     size_t group_linear_id = std::numeric_limits<size_t>::max();
-    std::vector<group_operation_data> operations;
+    group_operation_history operations;
     size_t num_items_exited = 0;
 
-    group_instance() : group_linear_id(std::numeric_limits<size_t>::max()) {}
-    explicit group_instance(size_t group_linear_id) : group_linear_id(group_linear_id) {}
+    // Start over with another group, retaining allocations.
+    void reset(const size_t new_group_linear_id = std::numeric_limits<size_t>::max()) {
+        group_linear_id = new_group_linear_id;
+        operations.reset();
+        num_items_exited = 0;
+    }
 };
 
 struct concurrent_group {
@@ -175,10 +335,13 @@ concurrent_group &get_concurrent_group(const sycl::group<Dimensions> &g) {
 
 struct sub_group_instance {
     size_t sub_group_linear_id = std::numeric_limits<size_t>::max();
-    std::vector<group_operation_data> operations;
+    group_operation_history operations;
 
-    sub_group_instance() : sub_group_linear_id(std::numeric_limits<size_t>::max()) {}
-    explicit sub_group_instance(size_t sub_group_linear_id) : sub_group_linear_id(sub_group_linear_id) {}
+    // Start over with another sub-group, retaining allocations.
+    void reset(const size_t new_sub_group_linear_id = std::numeric_limits<size_t>::max()) {
+        sub_group_linear_id = new_sub_group_linear_id;
+        operations.reset();
+    }
 };
 
 struct concurrent_sub_group {
@@ -194,13 +357,19 @@ inline detail::concurrent_sub_group &get_concurrent_group(const sycl::sub_group
 void check_group_op_validity(
     int linear_id_in_group, const group_operation_data &new_op, group_operation_data &existing_op);
 
+// Record that work items have reached the implicit exit operation without having performed any group operation before,
+// as if they had executed on fibers. Used when a group falls back to fibers after some of its items have already
+// completed as plain function calls.
+void register_exited_work_items(group_operation_history &operations, size_t expected_num_work_items,
+    int first_linear_id_in_group, size_t num_exited_work_items);
+
 // group operation function template
 
 template<typename Func>
-concept GroupOpInitFunction = std::is_invocable_r_v<std::unique_ptr<group_per_operation_data>, Func>;
+concept GroupOpInitFunction = std::is_pointer_v<std::invoke_result_t<Func, group_operation_arena &>>;
 
-inline std::unique_ptr<group_per_operation_data> default_group_op_init_function() {
-    return std::unique_ptr<group_per_operation_data>();
+inline group_no_operation_data *default_group_op_init_function(group_operation_arena & /* arena */) {
+    return nullptr;
 }
 
 template<typename T>
@@ -208,18 +377,24 @@ void default_group_op_function(T &per_group) {
     (void)per_group;
 }
 
+// `init` creates the per-operation data in the first work item to reach the operation, and `reached` is invoked by
+// every further work item. Once all work items have reached the operation, the last of them invokes `all_reached`,
+// which can compute results for the entire group. `complete` then returns the result of each work item.
 template<GroupOpInitFunction InitF = decltype(default_group_op_init_function),
-    typename PerOpT = typename std::invoke_result_t<InitF>::element_type,
+    typename PerOpT = std::remove_pointer_t<std::invoke_result_t<InitF, group_operation_arena &>>,
     typename ReachedF = decltype(default_group_op_function<PerOpT>),
+    typename AllReachedF = decltype(default_group_op_function<PerOpT>),
     typename CompleteF = decltype(default_group_op_function<PerOpT>)>
 struct group_operation_spec {
     using per_op_t = PerOpT;
     static_assert(std::is_invocable_r_v<void, ReachedF, PerOpT &>
             || std::is_invocable_r_v<void, ReachedF, PerOpT &, group_operation_data &>,
         "reached must be of type (PerOpT&) -> void or (PerOpT&, group_operation_data&) -> void");
+    static_assert(std::is_invocable_r_v<void, AllReachedF, PerOpT &>, "all_reached must be of type (PerOpT&) -> void");
     static_assert(std::is_invocable_v<CompleteF, PerOpT &>, "complete must be invocable with PerOpT&");
     const InitF &init = default_group_op_init_function;
     const ReachedF &reached = default_group_op_function<PerOpT>;
+    const AllReachedF &all_reached = default_group_op_function<PerOpT>;
     const CompleteF &complete = default_group_op_function<PerOpT>;
 };
 
@@ -238,56 +413,109 @@ auto perform_group_operation(G g, group_operation_id id, const Spec &spec) {
     new_op.expected_num_work_items = g.get_local_range().size();
     new_op.num_work_items_participating = 1;
     new_op.valid = true;
-    new_op.per_op_data = spec.init();
 
     const size_t new_op_index = ops_reached;
-
-    if(new_op_index == group_instance.operations.size()) {
-        // first item to reach this group op
-        group_instance.operations.push_back(std::move(new_op));
+    auto &operations = group_instance.operations;
+
+    if(new_op_index == operations.end_index()) {
+        // first item to reach this group op, which creates the per-operation data for all items
+        auto *const per_op = spec.init(operations.get_next_arena());
+        new_op.per_op_type = &group_per_operation_type_tag<typename Spec::per_op_t>;
+        new_op.per_op_data = per_op;
+        operations.push_back(new_op);
+        if(new_op.num_work_items_participating == new_op.expected_num_work_items) { spec.all_reached(*per_op); }
     } else {
         // not first item to reach this group op
-        SIMSYCL_CHECK(new_op_index < group_instance.operations.size() && "group operation reached in unexpected order");
+        SIMSYCL_CHECK(new_op_index < operations.end_index() && "group operation reached in unexpected order");
+        SIMSYCL_CHECK_MSG(new_op_index >= operations.begin_index(),
+            "group operation already complete: work item #%d is trying to enter an operation all other work items "
+            "have left",
+            linear_id_in_group);
 
-        auto &op = group_instance.operations[ops_reached];
+        auto &op = operations[new_op_index];
         check_group_op_validity(linear_id_in_group, new_op, op);
+        auto &per_op = get_per_operation_data<typename Spec::per_op_t>(op);
         if constexpr(requires(Spec::per_op_t &per_t, group_operation_data &op_t) { spec.reached(per_t, op_t); }) {
-            spec.reached(dynamic_cast<typename Spec::per_op_t &>(*op.per_op_data), op);
+            spec.reached(per_op, op);
         } else {
-            spec.reached(dynamic_cast<typename Spec::per_op_t &>(*op.per_op_data));
+            spec.reached(per_op);
         }
 
         op.num_work_items_participating++;
+        if(op.num_work_items_participating == op.expected_num_work_items) { spec.all_reached(per_op); }
     }
 
     ops_reached++;
 
     // wait for all work items to enter this group operation
+    this_concurrent_nd_item.blocking_operations = &operations;
+    this_concurrent_nd_item.blocking_operation_index = new_op_index;
     for(;;) {
         detail::yield_to_kernel_scheduler();
         // we cannot preserve a reference into `operations` across a yield since it might be resized by another item
-        const auto &op = group_instance.operations[new_op_index];
-        SIMSYCL_CHECK_MSG(op.valid, "group operation invalidated by another work item");
+        const auto &op = operations[new_op_index];
+        SIMSYCL_CHECK_MSG(op.valid, "group operation invalidated by diverging work items");
         if(op.num_work_items_participating == op.expected_num_work_items) break;
     }
-
-    return spec.complete(dynamic_cast<typename Spec::per_op_t &>(*group_instance.operations[new_op_index].per_op_data));
+    this_concurrent_nd_item.blocking_operations = nullptr;
+
+    // the operation (and its data) may be retired once this item has computed its result
+    struct departure {
+        group_operation_history &operations;
+        size_t index;
+        ~departure() { operations.depart(index); }
+    } const depart_after_complete{operations, new_op_index};
+    return spec.complete(get_per_operation_data<typename Spec::per_op_t>(operations[new_op_index]));
 }
 
 // more specific helper functions for group operations
 
-template<sycl::Group G, sycl::Pointer Ptr, sycl::Fundamental T>
-void joint_reduce_impl(G g, Ptr first, Ptr last, std::optional<T> init, T result) {
-    perform_group_operation(g, group_operation_id::joint_reduce,
+// Joint algorithms operate on a range shared by the entire group. The first work item to reach one computes the result
+// for the group, and depending on the active joint_algorithm_verification, later work items compute it again to
+// verify that all items passed the same range and an equivalent function object.
+inline bool should_verify_joint_result(const group_operation_data &op) {
+    switch(get_joint_algorithm_verification()) {
+        case joint_algorithm_verification::all_work_items: return true;
+        case joint_algorithm_verification::sampled:
+            return op.num_work_items_participating + 1 == op.expected_num_work_items;
+        case joint_algorithm_verification::none: return false;
+    }
+    return true;
+}
+
+template<sycl::Group G, sycl::Pointer Ptr, typename Compute>
+bool joint_bool_op_impl(G g, group_operation_id op_id, Ptr first, Ptr last, const Compute &compute) {
+    return perform_group_operation(g, op_id,
         group_operation_spec{//
-            .init = [&] { return std::make_unique<group_joint_reduce_data<Ptr, T>>(first, last, init, result); },
+            .init =
+                [&](group_operation_arena &arena) {
+                    return arena.create<group_joint_bool_op_data<Ptr>>(first, last, compute());
+                },
+            .reached =
+                [&](group_joint_bool_op_data<Ptr> &per_op, group_operation_data &op) {
+                    SIMSYCL_CHECK(per_op.first == first);
+                    SIMSYCL_CHECK(per_op.last == last);
+                    if(should_verify_joint_result(op)) { SIMSYCL_CHECK(per_op.result == compute()); }
+                },
+            .complete = [](const group_joint_bool_op_data<Ptr> &per_op) { return per_op.result; }});
+}
+
+template<sycl::Group G, sycl::Pointer Ptr, sycl::Fundamental T, typename Compute>
+T joint_reduce_impl(G g, Ptr first, Ptr last, std::optional<T> init, const Compute &compute) {
+    return perform_group_operation(g, group_operation_id::joint_reduce,
+        group_operation_spec{//
+            .init =
+                [&](group_operation_arena &arena) {
+                    return arena.create<group_joint_reduce_data<Ptr, T>>(first, last, init, compute());
+                },
             .reached =
-                [&](group_joint_reduce_data<Ptr, T> &per_op) {
+                [&](group_joint_reduce_data<Ptr, T> &per_op, group_operation_data &op) {
                     SIMSYCL_CHECK(per_op.first == first);
                     SIMSYCL_CHECK(per_op.last == last);
                     SIMSYCL_CHECK(per_op.init == init);
-                    SIMSYCL_CHECK(per_op.result == result);
-                }});
+                    if(should_verify_joint_result(op)) { SIMSYCL_CHECK(per_op.result == compute()); }
+                },
+            .complete = [](const group_joint_reduce_data<Ptr, T> &per_op) { return per_op.result; }});
 }
 
 template<sycl::Group G, sycl::Fundamental T, sycl::SyclFunctionObject Op>
@@ -295,8 +523,8 @@ T group_reduce_impl(G g, T x, std::optional<T> init, Op op) {
     return perform_group_operation(g, group_operation_id::reduce,
         group_operation_spec{//
             .init =
-                [&] {
-                    auto per_op = std::make_unique<group_reduce_data<T>>(g.get_local_range().size(), init);
+                [&](group_operation_arena &arena) {
+                    auto *per_op = arena.create<group_reduce_data<T>>(arena, g.get_local_range().size(), init);
                     per_op->values[g.get_local_linear_id()] = x;
                     return per_op;
                 },
@@ -306,31 +534,44 @@ T group_reduce_impl(G g, T x, std::optional<T> init, Op op) {
                     SIMSYCL_CHECK(per_op.values.size() == g.get_local_range().size());
                     per_op.values[g.get_local_linear_id()] = x;
                 },
-            .complete =
-                [&](const group_reduce_data<T> &per_op) {
+            .all_reached =
+                [&](group_reduce_data<T> &per_op) {
                     T result = per_op.values.front();
-                    if(init) { result = op(*init, result); }
-                    if(per_op.values.size() > 1) {
-                        for(auto i = per_op.values.cbegin() + 1; i != per_op.values.cend(); ++i) {
-                            result = op(result, *i);
-                        }
-                    }
-                    return result;
-                }});
+                    if(per_op.init) { result = op(*per_op.init, result); }
+                    for(auto i = per_op.values.begin() + 1; i != per_op.values.end(); ++i) { result = op(result, *i); }
+                    per_op.result = result;
+                },
+            .complete = [&](const group_reduce_data<T> &per_op) { return per_op.result; }});
 }
 
-template<sycl::Group G, sycl::Pointer Ptr, sycl::Fundamental T>
-void joint_scan_impl(
-    G g, group_operation_id op_id, Ptr first, Ptr last, std::optional<T> init, const std::vector<T> &results) {
+// `compute` fills a span with the scan results. Each work item writes them to its output range only after all work
+// items have reached the operation, which allows the output range to alias the input.
+template<sycl::Group G, sycl::Pointer InPtr, sycl::Pointer OutPtr, sycl::Fundamental T, typename Compute>
+void joint_scan_impl(G g, group_operation_id op_id, InPtr first, InPtr last, OutPtr result, std::optional<T> init,
+    const Compute &compute) {
     perform_group_operation(g, op_id,
         group_operation_spec{//
-            .init = [&] { return std::make_unique<group_joint_scan_data<Ptr, T>>(first, last, init, results); },
+            .init =
+                [&](group_operation_arena &arena) {
+                    auto *per_op = arena.create<group_joint_scan_data<InPtr, T>>(arena, first, last, init);
+                    compute(per_op->results);
+                    return per_op;
+                },
             .reached =
-                [&](group_joint_scan_data<Ptr, T> &per_op) {
+                [&](group_joint_scan_data<InPtr, T> &per_op, group_operation_data &op) {
                     SIMSYCL_CHECK(per_op.first == first);
                     SIMSYCL_CHECK(per_op.last == last);
                     SIMSYCL_CHECK(per_op.init == init);
-                    SIMSYCL_CHECK(per_op.results == results);
+                    if(should_verify_joint_result(op)) {
+                        std::vector<T> results(per_op.results.size());
+                        compute(std::span<T>(results));
+                        SIMSYCL_CHECK(std::equal(
+                            per_op.results.begin(), per_op.results.end(), results.begin(), results.end()));
+                    }
+                },
+            .complete =
+                [&](const group_joint_scan_data<InPtr, T> &per_op) {
+                    std::copy(per_op.results.begin(), per_op.results.end(), result);
                 }});
 }
 
@@ -339,8 +580,8 @@ T group_scan_impl(G g, group_operation_id op_id, T x, std::optional<T> init, Op
     return perform_group_operation(g, op_id,
         group_operation_spec{//
             .init =
-                [&] {
-                    auto per_op = std::make_unique<group_scan_data<T>>(g.get_local_range().size(), init);
+                [&](group_operation_arena &arena) {
+                    auto *per_op = arena.create<group_scan_data<T>>(arena, g.get_local_range().size(), init);
                     per_op->values[g.get_local_linear_id()] = x;
                     return per_op;
                 },
@@ -350,21 +591,22 @@ T group_scan_impl(G g, group_operation_id op_id, T x, std::optional<T> init, Op
                     SIMSYCL_CHECK(per_op.values.size() == g.get_local_range().size());
                     per_op.values[g.get_local_linear_id()] = x;
                 },
-            .complete = [&](const group_scan_data<T> &per_op) -> T {
-                std::vector<T> results(per_op.values.size());
-                if(op_id == group_operation_id::exclusive_scan) {
-                    results[0] = sycl::known_identity_v<Op, T>;
-                    if(init) { results[0] = op(*init, results[0]); }
-                    for(auto i = 0u; i < results.size() - 1; ++i) { results[i + 1] = op(results[i], per_op.values[i]); }
-                } else if(op_id == group_operation_id::inclusive_scan) {
-                    results[0] = per_op.values[0];
-                    if(init) { results[0] = op(*init, results[0]); }
-                    for(auto i = 1u; i < results.size(); ++i) { results[i] = op(results[i - 1], per_op.values[i]); }
-                } else {
-                    SIMSYCL_CHECK(false && "unexpected scan group operation id");
-                }
-                return results[g.get_local_linear_id()];
-            }});
+            .all_reached =
+                [&](group_scan_data<T> &per_op) {
+                    // scan in place
+                    auto &values = per_op.values;
+                    if(op_id == group_operation_id::exclusive_scan) {
+                        T sum = sycl::known_identity_v<Op, T>;
+                        if(per_op.init) { sum = op(*per_op.init, sum); }
+                        for(auto &value : values) { sum = op(sum, std::exchange(value, sum)); }
+                    } else if(op_id == group_operation_id::inclusive_scan) {
+                        if(per_op.init) { values[0] = op(*per_op.init, values[0]); }
+                        for(size_t i = 1; i < values.size(); ++i) { values[i] = op(values[i - 1], values[i]); }
+                    } else {
+                        SIMSYCL_CHECK(false && "unexpected scan group operation id");
+                    }
+                },
+            .complete = [&](const group_scan_data<T> &per_op) -> T { return per_op.values[g.get_local_linear_id()]; }});
 }
 
 } // namespace simsycl::detail
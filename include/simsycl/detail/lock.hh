@@ -21,6 +21,20 @@ class system_lock {
     std::lock_guard<std::recursive_mutex> m_lock;
 };
 
+/// Return whether `queue::submit` on this thread hands command groups to the asynchronous executor (see
+/// `set_async_queue_submission`) instead of executing them immediately.
+bool submits_asynchronously();
+
+/// Block until all command groups submitted asynchronously from any thread have completed. Does nothing when called
+/// from a command group that is itself executed asynchronously. Must not be called while holding a `system_lock`.
+void wait_for_async_commands();
+
+/// Waits for all asynchronous command groups on construction. Declared as a member before a `system_lock` member, it
+/// ensures that the lock is only acquired once the executor has drained.
+struct async_commands_barrier {
+    async_commands_barrier() { wait_for_async_commands(); }
+};
+
 /// Mutable state that is potentially shared between threads should be wrapped in a `shared_value` to ensure it can only
 /// be accessed when a `system_lock` is in scope.
 template<typename T>
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "allocation.hh"
+#include "utils.hh"
+#include "worker_pool.hh"
 
 #include "../sycl/device.hh"
 #include "../sycl/forward.hh"
@@ -12,9 +14,18 @@
 #include "../sycl/range.hh"
 #include "simsycl/schedule.hh"
 
+#include <algorithm>
+#include <array>
+#include <cassert>
 #include <cstddef>
 #include <cstring>
+#include <deque>
+#include <limits>
 #include <memory>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <typeinfo>
 #include <vector>
 
 
@@ -33,6 +44,10 @@ struct with_offset<sycl::id<Dimensions>> : std::true_type {};
 template<typename T>
 inline constexpr bool with_offset_v = with_offset<T>::value;
 
+// tag for constructing a reducer that accumulates a private partial result for a shared one, see reduction.hh
+struct private_reducer_t {
+} inline constexpr private_reducer;
+
 template<int Dimensions, typename Offset>
 auto make_offset_item(const sycl::id<Dimensions> &the_id, const sycl::range<Dimensions> &range, const Offset &offset) {
     if constexpr(std::is_same_v<Offset, no_offset_t>) {
@@ -42,8 +57,15 @@ auto make_offset_item(const sycl::id<Dimensions> &the_id, const sycl::range<Dime
     }
 }
 
+template<int Dimensions>
+sycl::range<Dimensions> unit_range() {
+    sycl::range<Dimensions> r;
+    for(int i = 0; i < Dimensions; ++i) { r[i] = 1; }
+    return r;
+}
+
 struct local_memory_requirement {
-    std::unique_ptr<void *> ptr;
+    std::unique_ptr<local_memory_slot> slot;
     size_t size = 0;
     size_t align = 1;
 };
@@ -52,23 +74,446 @@ struct local_memory_requirement {
 template<int Dimensions>
 using nd_kernel = std::function<void(const sycl::nd_item<Dimensions> &)>;
 
-template<int Dimensions, bool WithOffset>
-using simple_kernel = std::function<void(const sycl::item<Dimensions, WithOffset> &)>;
+// limit the number of work items scheduled at a time to avoid allocating huge index buffers
+inline constexpr size_t max_schedule_chunk_size = 16 << 10;
+
+// Round-robin and permutation schedules compute their order on the fly, so they can process chunks of any size.
+inline size_t get_max_schedule_chunk_size(const cooperative_schedule &schedule) {
+    const auto kind = schedule.get_kind();
+    return kind == schedule_kind::round_robin || kind == schedule_kind::permutation
+        ? std::numeric_limits<size_t>::max()
+        : max_schedule_chunk_size;
+}
+
+// Morton and tiled schedules traverse the multi-dimensional index space instead of ordering linear chunks, and fall
+// back to linear order where only a linear index space is known.
+inline bool is_spatial_schedule(const cooperative_schedule &schedule) {
+    return schedule.get_kind() == schedule_kind::morton || schedule.get_kind() == schedule_kind::tiled;
+}
+
+// Executes chunks of `chunk_size` work items, each in the order prescribed by `schedule`. The schedule state carries
+// over from one chunk to the next, so that each chunk executed by the same runner sees a different order.
+template<int Dimensions, typename Offset, typename Kernel>
+class schedule_chunk_runner {
+  public:
+    schedule_chunk_runner(const sycl::range<Dimensions> &range, const Offset &offset, const Kernel &kernel,
+        const cooperative_schedule &schedule, const size_t chunk_size)
+        : m_range(range), m_offset(offset), m_kernel(kernel), m_schedule(schedule), m_chunk_size(chunk_size) {
+        if(schedule.get_kind() == schedule_kind::permutation) {
+            m_schedule_state = static_cast<const permutation_schedule &>(schedule).init();
+        } else if(schedule.get_kind() != schedule_kind::round_robin && !is_spatial_schedule(schedule)) {
+            m_order.resize(chunk_size);
+            m_chunk_ids.resize(chunk_size);
+            m_schedule_state = schedule.init(m_order);
+        }
+    }
+
+    void run(const size_t chunk_offset) {
+        const auto chunk_end = std::min(chunk_offset + m_chunk_size, m_range.size());
+
+        // ids are only computed from a linear index once per chunk and incremented from there
+        if(m_schedule.get_kind() == schedule_kind::round_robin || is_spatial_schedule(m_schedule)) {
+            auto id = linear_index_to_id(m_range, chunk_offset);
+            for(size_t linear_id = chunk_offset; linear_id < chunk_end; ++linear_id) {
+                m_kernel(make_offset_item(id, m_range, m_offset));
+                increment_id(m_range, id);
+            }
+            return;
+        }
+
+        // permutations are not materialized, so we compute the id of each visited work item from its linear index
+        if(m_schedule.get_kind() == schedule_kind::permutation) {
+            const auto &permutation = static_cast<const permutation_schedule &>(m_schedule);
+            for(size_t position = 0; position < chunk_end - chunk_offset; ++position) {
+                const auto linear_id
+                    = chunk_offset + permutation.get_index(m_schedule_state, chunk_end - chunk_offset, position);
+                m_kernel(make_offset_item(linear_index_to_id(m_range, linear_id), m_range, m_offset));
+            }
+            m_schedule_state = permutation.update(m_schedule_state);
+            return;
+        }
+
+        // for other schedules, we tabulate the ids of each chunk before visiting them in schedule order
+        auto id = linear_index_to_id(m_range, chunk_offset);
+        for(size_t linear_id = chunk_offset; linear_id < chunk_end; ++linear_id) {
+            m_chunk_ids[linear_id - chunk_offset] = id;
+            increment_id(m_range, id);
+        }
+        for(size_t schedule_id = 0; schedule_id < m_chunk_size; ++schedule_id) {
+            const auto linear_id = chunk_offset + m_order[schedule_id];
+            if(linear_id < chunk_end) {
+                m_kernel(make_offset_item(m_chunk_ids[m_order[schedule_id]], m_range, m_offset));
+            }
+        }
+        m_schedule_state = m_schedule.update(m_schedule_state, m_order);
+    }
+
+  private:
+    const sycl::range<Dimensions> &m_range;
+    const Offset &m_offset;
+    const Kernel &m_kernel;
+    const cooperative_schedule &m_schedule;
+    size_t m_chunk_size;
+    std::vector<size_t> m_order;
+    std::vector<sycl::id<Dimensions>> m_chunk_ids;
+    cooperative_schedule::state m_schedule_state = 0;
+};
 
+// Executes the chunks of `chunk_size` work items starting at `first_chunk_offset`, `first_chunk_offset +
+// chunk_stride`, ..., each in the order prescribed by `schedule`.
+template<int Dimensions, typename Offset, typename Kernel>
+void sequential_for_chunks(const sycl::range<Dimensions> &range, const Offset &offset, const Kernel &kernel,
+    const cooperative_schedule &schedule, const size_t chunk_size, const size_t first_chunk_offset,
+    const size_t chunk_stride) //
+{
+    schedule_chunk_runner<Dimensions, Offset, Kernel> runner(range, offset, kernel, schedule, chunk_size);
+    for(size_t chunk_offset = first_chunk_offset; chunk_offset < range.size(); chunk_offset += chunk_stride) {
+        runner.run(chunk_offset);
+    }
+}
+
+// A box of ids within a range, the unit of work of spatial schedules.
 template<int Dimensions>
-using hierarchical_kernel = std::function<void(const sycl::group<Dimensions> &)>;
+struct index_box {
+    sycl::id<Dimensions> begin;
+    sycl::range<Dimensions> extent;
+};
 
-template<int Dimensions, typename Offset>
-void sequential_for(const sycl::range<Dimensions> &range, const Offset &offset,
-    const simple_kernel<Dimensions, with_offset_v<Offset>> &kernel);
+// Halves a box along its largest dimension, preferring the slowest-varying one on ties, so that recursive halving of a
+// range whose extents are equal powers of two visits the ids in Morton order.
+template<int Dimensions>
+std::pair<index_box<Dimensions>, index_box<Dimensions>> split_index_box(const index_box<Dimensions> &box) {
+    int split_dim = 0;
+    for(int d = 1; d < Dimensions; ++d) {
+        if(box.extent[d] > box.extent[split_dim]) { split_dim = d; }
+    }
+    auto lower = box;
+    auto upper = box;
+    lower.extent[split_dim] = div_ceil(box.extent[split_dim], size_t{2});
+    upper.begin[split_dim] += lower.extent[split_dim];
+    upper.extent[split_dim] -= lower.extent[split_dim];
+    return {lower, upper};
+}
 
+// Chooses tile extents of at most `tile_size` items which are as even across dimensions as `range` allows, by giving
+// each dimension, from the shortest to the longest, its fair share of the items not yet claimed by the shorter ones.
 template<int Dimensions>
+sycl::range<Dimensions> get_tile_range(const sycl::range<Dimensions> &range, const size_t tile_size) {
+    std::array<int, Dimensions> dims_by_extent;
+    std::iota(dims_by_extent.begin(), dims_by_extent.end(), 0);
+    std::stable_sort(dims_by_extent.begin(), dims_by_extent.end(),
+        [&](const int lhs, const int rhs) { return range[lhs] < range[rhs]; });
+
+    sycl::range<Dimensions> tile = unit_range<Dimensions>();
+    size_t remaining = tile_size;
+    for(int i = 0; i < Dimensions; ++i) {
+        // largest edge such that edge^dims_left <= remaining
+        const auto dims_left = Dimensions - i;
+        size_t edge = dims_left == 1 ? std::min(remaining, range[dims_by_extent[i]]) : 1;
+        const auto fits = [&](const size_t e) {
+            size_t volume = 1;
+            for(int d = 0; d < dims_left; ++d) { volume *= e; }
+            return volume <= remaining;
+        };
+        while(edge < range[dims_by_extent[i]] && fits(edge + 1)) { ++edge; }
+        tile[dims_by_extent[i]] = edge;
+        remaining /= edge;
+    }
+    return tile;
+}
+
+// Partitions `range` into boxes listed in the traversal order of the spatial `schedule`, aiming for at least
+// `min_num_boxes` boxes so that worker threads can balance their load.
+template<int Dimensions>
+std::vector<index_box<Dimensions>> partition_spatially(
+    const sycl::range<Dimensions> &range, const cooperative_schedule &schedule, const size_t min_num_boxes) //
+{
+    std::vector<index_box<Dimensions>> boxes;
+    if(schedule.get_kind() == schedule_kind::tiled) {
+        const auto tile = get_tile_range(range, static_cast<const tiled_schedule &>(schedule).get_tile_size());
+        sycl::range<Dimensions> num_tiles;
+        for(int d = 0; d < Dimensions; ++d) { num_tiles[d] = div_ceil(range[d], tile[d]); }
+        for_each_id_in_range(num_tiles, [&](const sycl::id<Dimensions> &tile_id) {
+            index_box<Dimensions> box{tile_id * sycl::id(tile), tile};
+            for(int d = 0; d < Dimensions; ++d) { box.extent[d] = std::min(tile[d], range[d] - box.begin[d]); }
+            boxes.push_back(box);
+        });
+        return boxes;
+    }
+
+    // halving every box of one level of the Morton recursion preserves the traversal order
+    assert(schedule.get_kind() == schedule_kind::morton);
+    boxes.push_back({sycl::id<Dimensions>(), range});
+    while(boxes.size() < min_num_boxes) {
+        std::vector<index_box<Dimensions>> next_level;
+        for(const auto &box : boxes) {
+            if(box.extent.size() > 1) {
+                const auto [lower, upper] = split_index_box(box);
+                next_level.push_back(lower);
+                next_level.push_back(upper);
+            } else {
+                next_level.push_back(box);
+            }
+        }
+        if(next_level.size() == boxes.size()) break;
+        boxes = std::move(next_level);
+    }
+    return boxes;
+}
+
+// Invokes `fn(id)` for every id of `box` in the traversal order of the spatial `schedule`.
+template<int Dimensions, typename Fn>
+void for_each_id_in_box(const index_box<Dimensions> &box, const cooperative_schedule &schedule, const Fn &fn) {
+    if(schedule.get_kind() == schedule_kind::tiled) {
+        for_each_id_in_range(box.extent, [&](const sycl::id<Dimensions> &id) { fn(box.begin + id); });
+        return;
+    }
+
+    assert(schedule.get_kind() == schedule_kind::morton);
+    std::vector<index_box<Dimensions>> stack{box};
+    while(!stack.empty()) {
+        const auto top = stack.back();
+        stack.pop_back();
+        if(top.extent.size() == 1) {
+            fn(top.begin);
+        } else if(top.extent.size() > 1) {
+            const auto [lower, upper] = split_index_box(top);
+            stack.push_back(upper);
+            stack.push_back(lower);
+        }
+    }
+}
+
+// Executes `kernel(worker_index, item)` for every id of `range` in the traversal order of a spatial `schedule`, with
+// the boxes of the traversal distributed across up to `num_threads` worker threads.
+template<int Dimensions, typename Offset, typename Kernel>
+void spatial_for(const sycl::range<Dimensions> &range, const Offset &offset, const Kernel &kernel,
+    const cooperative_schedule &schedule, const size_t num_threads) //
+{
+    if(range.size() == 0) return;
+    constexpr size_t boxes_per_thread = 16;
+    const auto boxes = partition_spatially(range, schedule, num_threads > 1 ? num_threads * boxes_per_thread : 1);
+    run_work_stealing(std::min(num_threads, boxes.size()), boxes.size(), [&](const size_t worker_index, size_t box) {
+        for_each_id_in_box(boxes[box], schedule,
+            [&](const sycl::id<Dimensions> &id) { kernel(worker_index, make_offset_item(id, range, offset)); });
+    });
+}
+
+template<int Dimensions, typename Offset, typename Kernel>
+void sequential_for(const sycl::range<Dimensions> &range, const Offset &offset, const Kernel &kernel) {
+    const auto &schedule = get_cooperative_schedule();
+
+    if(is_spatial_schedule(schedule)) {
+        spatial_for(range, offset, [&](size_t /* worker_index */, const auto &item) { kernel(item); }, schedule, 1);
+        return;
+    }
+
+    // directly execute the kernel if the schedule is round robin
+    if(schedule.get_kind() == schedule_kind::round_robin) {
+        for_each_id_in_range(
+            range, [&](const sycl::id<Dimensions> &id) { kernel(make_offset_item(id, range, offset)); });
+        return;
+    }
+
+    const auto schedule_chunk_size = std::min(range.size(), get_max_schedule_chunk_size(schedule));
+    sequential_for_chunks(range, offset, kernel, schedule, schedule_chunk_size, 0, schedule_chunk_size);
+}
+
+struct threaded_for_plan {
+    size_t chunk_size = 0;
+    size_t num_workers = 0;
+};
+
+inline threaded_for_plan plan_threaded_for(
+    const size_t range_size, const size_t num_threads, const cooperative_schedule &schedule) //
+{
+    // hand out many chunks per thread so that idle threads can steal work from those executing expensive items, but
+    // don't bother splitting up tiny ranges where the cost of waking up worker threads outweighs the kernel itself
+    constexpr size_t chunks_per_thread = 16;
+    constexpr size_t min_chunk_size = 256;
+    const auto chunk_size = std::clamp(div_ceil(range_size, num_threads * chunks_per_thread),
+        std::min(range_size, min_chunk_size), get_max_schedule_chunk_size(schedule));
+    const auto num_chunks = div_ceil(range_size, chunk_size);
+    return {chunk_size, std::min(num_threads, num_chunks)};
+}
+
+template<int Dimensions, typename Offset, typename Kernel>
+void threaded_for(
+    const sycl::range<Dimensions> &range, const Offset &offset, const Kernel &kernel, const size_t num_threads) //
+{
+    if(range.size() == 0) return;
+    // worker threads don't share our thread-local schedule, so we pass it explicitly. Each worker carries its schedule
+    // state from one chunk to the next, regardless of whether it owned the chunk initially or stole it.
+    const auto &schedule = get_cooperative_schedule();
+    const auto [chunk_size, num_workers] = plan_threaded_for(range.size(), num_threads, schedule);
+    if(is_spatial_schedule(schedule)) {
+        spatial_for(
+            range, offset, [&](size_t /* worker_index */, const auto &item) { kernel(item); }, schedule, num_workers);
+        return;
+    }
+
+    const auto num_chunks = div_ceil(range.size(), chunk_size);
+
+    std::deque<schedule_chunk_runner<Dimensions, Offset, Kernel>> runners;
+    for(size_t worker_index = 0; worker_index < num_workers; ++worker_index) {
+        runners.emplace_back(range, offset, kernel, schedule, chunk_size);
+    }
+    run_work_stealing(num_workers, num_chunks,
+        [&](const size_t worker_index, const size_t chunk) { runners[worker_index].run(chunk * chunk_size); });
+}
+
+// Merges private reducers into `shared` pairwise in a fixed tree order, so that the result does not depend on the order
+// in which workers complete. The partial results themselves still depend on which chunks each worker executed.
+template<typename Reducer>
+void merge_private_reducers(Reducer &shared, std::deque<Reducer> &partials) {
+    for(size_t stride = 1; stride < partials.size(); stride *= 2) {
+        for(size_t i = 0; i + stride < partials.size(); i += 2 * stride) { partials[i].merge(partials[i + stride]); }
+    }
+    if(!partials.empty()) { shared.merge(partials.front()); }
+}
+
+// Like threaded_for, but each worker passes its own private reducers to `kernel(item, reducers...)`, which are merged
+// into the shared `reducers` once all workers have completed.
+template<int Dimensions, typename Offset, typename Kernel, typename... Reducers>
+void threaded_for_with_reductions(const sycl::range<Dimensions> &range, const Offset &offset, const Kernel &kernel,
+    const size_t num_threads, Reducers &...reducers) //
+{
+    if(range.size() == 0) return;
+    const auto &schedule = get_cooperative_schedule();
+    const auto [chunk_size, num_workers] = plan_threaded_for(range.size(), num_threads, schedule);
+
+    // reducers are neither copyable nor movable, so they are constructed in-place in a deque
+    std::tuple<std::deque<Reducers>...> private_reducers;
+    std::apply(
+        [&](auto &...partials) {
+            for(size_t worker_index = 0; worker_index < num_workers; ++worker_index) {
+                (partials.emplace_back(private_reducer, reducers), ...);
+            }
+        },
+        private_reducers);
+
+    // chunks combine into the private reducers of the worker executing them, whether it owned the chunk or stole it
+    const auto make_worker_kernel = [&](const size_t worker_index) {
+        return [&, worker_index](const auto &item) {
+            std::apply([&](auto &...partials) { kernel(item, partials[worker_index]...); }, private_reducers);
+        };
+    };
+    using worker_kernel = decltype(make_worker_kernel(0));
+    std::deque<worker_kernel> worker_kernels;
+    for(size_t worker_index = 0; worker_index < num_workers; ++worker_index) {
+        worker_kernels.emplace_back(make_worker_kernel(worker_index));
+    }
+
+    if(is_spatial_schedule(schedule)) {
+        spatial_for(
+            range, offset,
+            [&](const size_t worker_index, const auto &item) { worker_kernels[worker_index](item); }, schedule,
+            num_workers);
+    } else {
+        std::deque<schedule_chunk_runner<Dimensions, Offset, worker_kernel>> runners;
+        for(size_t worker_index = 0; worker_index < num_workers; ++worker_index) {
+            runners.emplace_back(range, offset, worker_kernels[worker_index], schedule, chunk_size);
+        }
+        run_work_stealing(num_workers, div_ceil(range.size(), chunk_size),
+            [&](const size_t worker_index, const size_t chunk) { runners[worker_index].run(chunk * chunk_size); });
+    }
+
+    std::apply([&](auto &...partials) { (merge_private_reducers(reducers, partials), ...); }, private_reducers);
+}
+
+// Deterministic reductions split the index space into at most this many blocks, each with its own private reducers.
+inline constexpr size_t max_deterministic_reduction_blocks = 256;
+inline constexpr size_t min_deterministic_reduction_block_size = 256;
+
+// Like threaded_for_with_reductions, but with private reducers per block of the index space instead of per worker.
+// Blocks only depend on the size of the range and each starts a fresh schedule, so the results are independent of the
+// number of threads.
+template<int Dimensions, typename Offset, typename Kernel, typename... Reducers>
+void blocked_for_with_reductions(const sycl::range<Dimensions> &range, const Offset &offset, const Kernel &kernel,
+    const size_t num_threads, Reducers &...reducers) //
+{
+    if(range.size() == 0) return;
+    const auto &schedule = get_cooperative_schedule();
+    const auto block_size = std::min(
+        std::max(div_ceil(range.size(), max_deterministic_reduction_blocks), min_deterministic_reduction_block_size),
+        get_max_schedule_chunk_size(schedule));
+    const auto num_blocks = div_ceil(range.size(), block_size);
+    const auto num_workers = std::min(num_threads, num_blocks);
+
+    std::tuple<std::deque<Reducers>...> block_reducers;
+    std::apply(
+        [&](auto &...partials) {
+            for(size_t block = 0; block < num_blocks; ++block) {
+                (partials.emplace_back(private_reducer, reducers), ...);
+            }
+        },
+        block_reducers);
+
+    run_work_stealing(num_workers, num_blocks, [&](const size_t /* worker_index */, const size_t block) {
+        std::apply(
+            [&](auto &...partials) {
+                const auto block_kernel = [&](const auto &item) { kernel(item, partials[block]...); };
+                // a single chunk, so the schedule state does not carry over from the previous block
+                sequential_for_chunks(
+                    range, offset, block_kernel, schedule, block_size, block * block_size, range.size());
+            },
+            block_reducers);
+    });
+
+    std::apply([&](auto &...partials) { (merge_private_reducers(reducers, partials), ...); }, block_reducers);
+}
+
+template<int Dimensions, typename Kernel>
+void execute_work_group(const sycl::range<Dimensions> &num_work_groups,
+    const std::optional<sycl::range<Dimensions>> &work_group_size, const Kernel &kernel, const size_t group_linear_id) {
+    const auto type
+        = work_group_size.has_value() ? group_type::hierarchical_explicit_size : group_type::hierarchical_implicit_size;
+    const auto group_id = linear_index_to_id(num_work_groups, group_linear_id);
+    const auto group_item = make_item(group_id, num_work_groups);
+    const auto physical_local_item
+        = make_item(sycl::id<Dimensions>(), work_group_size.value_or(unit_range<Dimensions>()));
+    const auto global_item = make_item(group_id * sycl::id(physical_local_item.get_range()),
+        physical_local_item.get_range() * group_item.get_range(), sycl::id<Dimensions>());
+    kernel(make_group(type, physical_local_item, global_item, group_item, nullptr));
+}
+
+template<int Dimensions, typename Kernel>
 void sequential_for_work_group(sycl::range<Dimensions> num_work_groups,
-    std::optional<sycl::range<Dimensions>> work_group_size, const hierarchical_kernel<Dimensions> &kernel);
+    std::optional<sycl::range<Dimensions>> work_group_size, const Kernel &kernel) {
+    for(size_t group_linear_id = 0; group_linear_id < num_work_groups.size(); ++group_linear_id) {
+        execute_work_group(num_work_groups, work_group_size, kernel, group_linear_id);
+    }
+}
+
+// Distributes work groups across worker threads by work stealing. The local memory slots of the launch are shared by
+// all groups, so each worker binds them to its own allocations, which it re-uses for every group it executes.
+// Variables in work-group scope and `private_memory` live on the stack of the executing thread and need no special
+// treatment.
+template<int Dimensions, typename Kernel>
+void threaded_for_work_group(sycl::range<Dimensions> num_work_groups,
+    std::optional<sycl::range<Dimensions>> work_group_size, const std::vector<local_memory_requirement> &local_memory,
+    const Kernel &kernel, const size_t num_threads) //
+{
+    const auto num_workers = std::min(num_threads, num_work_groups.size());
+    std::vector<std::vector<allocation>> worker_allocations(num_workers);
+    std::vector<std::vector<void *>> worker_bindings(num_workers);
+    for(size_t worker_index = 0; worker_index < num_workers; ++worker_index) {
+        for(const auto &requirement : local_memory) {
+            auto &local_allocation = worker_allocations[worker_index].emplace_back(requirement.size, requirement.align);
+            worker_bindings[worker_index].push_back(local_allocation.get());
+        }
+    }
+
+    run_work_stealing(num_workers, num_work_groups.size(), [&](const size_t worker_index, const size_t group_id) {
+        local_memory_binding_scope binding_scope(&worker_bindings[worker_index]);
+        execute_work_group(num_work_groups, work_group_size, kernel, group_id);
+    });
+}
 
 template<int Dimensions>
 void cooperative_for_nd_range(const sycl::device &device, const sycl::nd_range<Dimensions> &range,
-    const std::vector<local_memory_requirement> &local_memory, const nd_kernel<Dimensions> &kernel);
+    const std::vector<local_memory_requirement> &local_memory, const nd_kernel<Dimensions> &kernel,
+    size_t num_worker_threads, const std::type_info &kernel_name_type, const std::type_info &kernel_func_type);
 
 template<typename KernelName, int Dimensions, typename Offset, typename KernelFunc, typename... Reducers>
 void execute_parallel_for(const sycl::range<Dimensions> &range, const Offset &offset, sycl::kernel_handler kh,
@@ -79,26 +524,26 @@ void execute_parallel_for(const sycl::range<Dimensions> &range, const Offset &of
 
     register_kernel_on_static_construction<KernelName, KernelFunc>();
 
-    // directly execute the kernel if the schedule is round robin
-    if(dynamic_cast<const round_robin_schedule *>(&get_cooperative_schedule())) {
+    const auto invoke_kernel = [&](const item_type &item, auto &...item_reducers) {
         if constexpr(std::is_invocable_v<const KernelFunc, item_type, Reducers &..., sycl::kernel_handler>) {
-            for_each_id_in_range(range,
-                [&](const sycl::id<Dimensions> &id) { func(make_offset_item(id, range, offset), reducers..., kh); });
+            func(item, item_reducers..., kh);
         } else {
-            for_each_id_in_range(
-                range, [&](const sycl::id<Dimensions> &id) { func(make_offset_item(id, range, offset), reducers...); });
+            static_assert(std::is_invocable_v<const KernelFunc, item_type, Reducers &...>);
+            func(item, item_reducers...);
         }
-        return;
-    }
-
-    simple_kernel<Dimensions, with_offset_v<Offset>> kernel;
-    if constexpr(std::is_invocable_v<const KernelFunc, item_type, Reducers &..., sycl::kernel_handler>) {
-        kernel = [&](const item_type &item) { func(item, reducers..., kh); };
+    };
+    const auto kernel = [&](const item_type &item) { invoke_kernel(item, reducers...); };
+
+    const auto num_threads = get_num_worker_threads();
+    if(sizeof...(Reducers) > 0 && get_deterministic_reductions()) {
+        blocked_for_with_reductions(range, offset, invoke_kernel, num_threads, reducers...);
+    } else if(num_threads > 1 && sizeof...(Reducers) > 0) {
+        threaded_for_with_reductions(range, offset, invoke_kernel, num_threads, reducers...);
+    } else if(num_threads > 1) {
+        threaded_for(range, offset, kernel, num_threads);
     } else {
-        static_assert(std::is_invocable_v<const KernelFunc, item_type, Reducers &...>);
-        kernel = [&](const item_type &item) { func(item, reducers...); };
+        sequential_for(range, offset, kernel);
     }
-    sequential_for(range, offset, kernel);
 }
 
 template<typename KernelName, int Dimensions, typename KernelFunc, typename... Reducers>
@@ -116,7 +561,10 @@ void execute_parallel_for(const sycl::device &device, const sycl::nd_range<Dimen
         static_assert(std::is_invocable_v<const KernelFunc, sycl::nd_item<Dimensions>, Reducers &...>);
         kernel = [&](const sycl::nd_item<Dimensions> &item) { func(item, reducers...); };
     }
-    cooperative_for_nd_range(device, range, local_memory, kernel);
+    // nd_range reducers combine into a single shared value, so kernels with reductions execute on a single thread
+    const auto num_threads = sizeof...(Reducers) == 0 ? get_num_worker_threads() : 1;
+    cooperative_for_nd_range(
+        device, range, local_memory, kernel, num_threads, typeid(KernelName *), typeid(KernelFunc));
 }
 
 template<typename KernelName, typename KernelFunc>
@@ -179,16 +627,21 @@ void parallel_for_work_group(const sycl::device &device, sycl::range<Dimensions>
 {
     register_kernel_on_static_construction<KernelName, WorkgroupFunctionType>();
 
-    hierarchical_kernel<Dimensions> kernel;
-    if constexpr(std::is_invocable_v<const WorkgroupFunctionType, sycl::group<Dimensions>, sycl::kernel_handler>) {
-        kernel = [&](const sycl::group<Dimensions> &group) { kernel_func(group, kh); };
-    } else {
-        static_assert(std::is_invocable_v<const WorkgroupFunctionType, sycl::group<Dimensions>>);
-        kernel = kernel_func;
-    }
+    const auto kernel = [&](const sycl::group<Dimensions> &group) {
+        if constexpr(std::is_invocable_v<const WorkgroupFunctionType, sycl::group<Dimensions>, sycl::kernel_handler>) {
+            kernel_func(group, kh);
+        } else {
+            static_assert(std::is_invocable_v<const WorkgroupFunctionType, sycl::group<Dimensions>>);
+            kernel_func(group);
+        }
+    };
 
     const auto local_allocations = prepare_hierarchical_parallel_for(device, work_group_size, local_memory);
-    sequential_for_work_group(num_work_groups, work_group_size, kernel);
+    if(const auto num_threads = get_num_worker_threads(); num_threads > 1 && num_work_groups.size() > 1) {
+        threaded_for_work_group(num_work_groups, work_group_size, local_memory, kernel, num_threads);
+    } else {
+        sequential_for_work_group(num_work_groups, work_group_size, kernel);
+    }
 }
 
 } // namespace simsycl::detail
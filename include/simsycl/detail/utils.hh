@@ -59,6 +59,16 @@ sycl::id<Dimensions> linear_index_to_id(const sycl::range<Dimensions> &range, si
     return id;
 }
 
+// Advance `id` to its successor in linear index order, which avoids the divisions of `linear_index_to_id`.
+template<int Dimensions>
+void increment_id(const sycl::range<Dimensions> &range, sycl::id<Dimensions> &id) {
+    for(int d = Dimensions - 1; d > 0; --d) {
+        if(++id[d] < range[d]) return;
+        id[d] = 0;
+    }
+    ++id[0];
+}
+
 template<typename F>
 void for_each_id_in_range(const sycl::range<1> &range, F &&f) {
     for(size_t i = 0; i < range[0]; ++i) { f(sycl::id<1>(i)); }
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+
+namespace simsycl::detail {
+
+/// Invoke `fn(worker_index)` once for each `worker_index` in `[0, num_workers)` and wait for all invocations to
+/// complete.
+///
+/// Worker 0 runs on the calling thread, all others are dispatched to a process-wide pool of OS threads which is grown
+/// on demand. Worker threads inherit all thread-local kernel settings of the caller (see `kernel_settings`). If any
+/// invocation throws, the first exception is re-thrown on the calling thread after all workers have finished.
+void run_on_worker_threads(size_t num_workers, const std::function<void(size_t)> &fn);
+
+/// Construct the process-wide worker thread pool if it does not exist yet, without starting any threads.
+void construct_worker_pool();
+
+/// Invoke `fn(worker_index, task_index)` once for each `task_index` in `[0, num_tasks)` on up to `num_workers` worker
+/// threads and wait for all invocations to complete.
+///
+/// Each worker starts out owning a contiguous range of tasks, which it executes in ascending order. Once its range is
+/// exhausted, it steals the upper half of the remaining tasks of another worker, starting its search at a randomly
+/// selected victim, and returns once no worker has tasks left. Successful steals are counted in
+/// `get_work_stealing_statistics()`.
+void run_work_stealing(size_t num_workers, size_t num_tasks, const std::function<void(size_t, size_t)> &fn);
+
+} // namespace simsycl::detail
@@ -3,10 +3,22 @@
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 
 namespace simsycl {
 
+/// Identifies the builtin schedules, which allows kernel launches to take shortcuts for them.
+enum class schedule_kind {
+    custom,
+    round_robin,
+    shuffle,
+    permutation,
+    morton,
+    tiled,
+};
+
 /// A schedule generates execution orders for work items within the constraints of group synchronization.
 ///
 /// The kernel function is invoked once for each work item as prescribed by the schedule. For ND-range kernels, they can
@@ -33,11 +45,22 @@ class cooperative_schedule {
     ///
     /// The retured `state` is to be carried into the next invocation of `update()`.
     [[nodiscard]] virtual state update(state state_before, std::vector<size_t> &order) const = 0;
+
+    /// Return the builtin schedule this is an instance of, or `schedule_kind::custom` for user-defined schedules.
+    [[nodiscard]] schedule_kind get_kind() const { return m_kind; }
+
+  protected:
+    explicit cooperative_schedule(const schedule_kind kind) : m_kind(kind) {}
+
+  private:
+    schedule_kind m_kind = schedule_kind::custom;
 };
 
 /// A schedule executing threads in-order by linear thread id.
 class round_robin_schedule final : public cooperative_schedule {
   public:
+    round_robin_schedule() : cooperative_schedule(schedule_kind::round_robin) {}
+
     [[nodiscard]] state init(std::vector<size_t> &order) const override;
     [[nodiscard]] state update(state state_before, std::vector<size_t> &order) const override;
 };
@@ -48,8 +71,8 @@ class round_robin_schedule final : public cooperative_schedule {
 /// `shuffle_schedule` (potentially with multiple seeds) allows fuzzing that assumption.
 class shuffle_schedule final : public cooperative_schedule {
   public:
-    shuffle_schedule() = default;
-    explicit shuffle_schedule(uint64_t seed) : m_seed(seed) {}
+    shuffle_schedule() : cooperative_schedule(schedule_kind::shuffle) {}
+    explicit shuffle_schedule(uint64_t seed) : cooperative_schedule(schedule_kind::shuffle), m_seed(seed) {}
 
     [[nodiscard]] state init(std::vector<size_t> &order) const override;
     [[nodiscard]] state update(state state_before, std::vector<size_t> &order) const override;
@@ -58,6 +81,75 @@ class shuffle_schedule final : public cooperative_schedule {
     uint64_t m_seed = 1234567890;
 };
 
+/// A schedule executing threads in a pseudo-random order which, unlike `shuffle_schedule`, is computed index by index
+/// from a seeded bijection instead of by shuffling an index vector. Each collective barrier selects a new permutation.
+///
+/// Since orders do not occupy memory, the index space of basic `parallel_for` kernels is permuted as a whole instead of
+/// in bounded chunks, which allows fuzzing large kernels at constant memory. Permutations are not drawn uniformly like
+/// those of `shuffle_schedule`.
+class permutation_schedule final : public cooperative_schedule {
+  public:
+    permutation_schedule() : cooperative_schedule(schedule_kind::permutation) {}
+    explicit permutation_schedule(uint64_t seed) : cooperative_schedule(schedule_kind::permutation), m_seed(seed) {}
+
+    [[nodiscard]] state init(std::vector<size_t> &order) const override;
+    [[nodiscard]] state update(state state_before, std::vector<size_t> &order) const override;
+
+    /// Return the state of the initial round without materializing its order.
+    [[nodiscard]] state init() const;
+
+    /// Return the state of the round following `state_before` without materializing its order.
+    [[nodiscard]] state update(state state_before) const;
+
+    /// Return the index at `position` in the permutation of `[0, size)` selected by `round_state`.
+    [[nodiscard]] size_t get_index(state round_state, size_t size, size_t position) const;
+
+  private:
+    uint64_t m_seed = 1234567890;
+};
+
+/// A schedule visiting the ids of multi-dimensional basic `parallel_for` kernels in Z-order (Morton order), which keeps
+/// recently visited ids close together in every dimension and improves the locality of stencil kernels.
+///
+/// The index space is recursively halved along its largest dimension, so ranges whose extents are equal powers of two
+/// are visited in exact Morton order, and all others in a space-filling order close to it. Worker threads execute the
+/// boxes of one level of this recursion. Where only a linear index space is known, such as for the work items of
+/// ND-range kernels or the blocks of deterministic reductions, items execute in linear order as with a
+/// `round_robin_schedule`.
+class morton_schedule final : public cooperative_schedule {
+  public:
+    morton_schedule() : cooperative_schedule(schedule_kind::morton) {}
+
+    [[nodiscard]] state init(std::vector<size_t> &order) const override;
+    [[nodiscard]] state update(state state_before, std::vector<size_t> &order) const override;
+};
+
+/// Number of work items per tile of a `tiled_schedule` unless configured otherwise. With one 8-byte element per work
+/// item, a tile of a buffer occupies 32 KiB, the size of a typical L1 data cache.
+inline constexpr size_t default_tile_size = 4096;
+
+/// A schedule visiting the ids of multi-dimensional basic `parallel_for` kernels tile by tile, each in row-major order.
+///
+/// Tiles hold up to `tile_size` work items, and their extents are as even across dimensions as the range allows. Tiles
+/// are visited in row-major order and distributed across worker threads as a whole. Choosing a tile size such that the
+/// data a tile touches fits into the L1 or L2 cache of the host improves the locality of stencil kernels. Where only a
+/// linear index space is known, such as for the work items of ND-range kernels or the blocks of deterministic
+/// reductions, items execute in linear order as with a `round_robin_schedule`.
+class tiled_schedule final : public cooperative_schedule {
+  public:
+    tiled_schedule() : cooperative_schedule(schedule_kind::tiled) {}
+    explicit tiled_schedule(size_t tile_size);
+
+    [[nodiscard]] state init(std::vector<size_t> &order) const override;
+    [[nodiscard]] state update(state state_before, std::vector<size_t> &order) const override;
+
+    /// Return the maximum number of work items per tile.
+    [[nodiscard]] size_t get_tile_size() const { return m_tile_size; }
+
+  private:
+    size_t m_tile_size = default_tile_size;
+};
+
 /// Return the thread-locally active schedule.
 const cooperative_schedule &get_cooperative_schedule();
 
@@ -66,4 +158,234 @@ const cooperative_schedule &get_cooperative_schedule();
 /// Must not be called from within a kernel.
 void set_cooperative_schedule(std::shared_ptr<const cooperative_schedule> schedule);
 
+/// Return the thread-locally active number of OS threads that kernels are distributed across.
+size_t get_num_worker_threads();
+
+/// Set the thread-locally active number of OS threads for future kernel invocations.
+///
+/// With a value of 1 (the default), all work items execute on the thread submitting the kernel. Larger values split the
+/// index space of basic `parallel_for` kernels into chunks which are executed concurrently, each in the order
+/// prescribed by the active `cooperative_schedule`. Every thread starts out with a contiguous range of chunks and
+/// steals from other threads once it runs out, which balances kernels whose work items differ in cost. ND-range kernels
+/// distribute their concurrently executing work groups across threads, with each thread running the fibers and local
+/// memory allocations of its own groups. Hierarchical `parallel_for_work_group` kernels are distributed across threads
+/// group by group, with each thread owning a copy of the local memory. Basic `parallel_for` kernels with reductions
+/// combine into private reducers per thread, which are merged after the kernel completes. Each partial result covers
+/// the chunks its thread executed, so floating-point reductions can round differently depending on the thread count
+/// and from run to run (see `set_deterministic_reductions`). ND-range kernels with reductions always execute on a
+/// single thread. Must not be called from within a kernel.
+void set_num_worker_threads(size_t num_threads);
+
+/// Return whether reductions in basic `parallel_for` kernels are combined in an order that only depends on the index
+/// space of the kernel.
+bool get_deterministic_reductions();
+
+/// Enable or disable deterministic reductions for future basic `parallel_for` kernel invocations on this thread.
+///
+/// By default, reductions combine into one private reducer per worker thread, so floating-point results depend on the
+/// number of threads. In deterministic mode, the index space is split into blocks whose size only depends on the
+/// size of the range. Each block combines into its own private reducer in the order prescribed by the schedule, and
+/// blocks are merged pairwise by block index. Results are then bit-identical for any number of worker threads,
+/// including one. ND-range kernels with reductions always execute on a single thread and are unaffected. Must not be
+/// called from within a kernel.
+void set_deterministic_reductions(bool enable);
+
+/// Return whether command groups submitted to queues from this thread execute asynchronously.
+bool get_async_queue_submission();
+
+/// Enable or disable asynchronous execution of command groups submitted to queues from this thread.
+///
+/// By default, `queue::submit` executes the command group function and its kernel before returning, so host code
+/// never overlaps with device work. In asynchronous mode, command groups are appended to a process-wide FIFO instead,
+/// which a background thread executes with the kernel settings of the submitting thread. Events report the actual
+/// progress of their command, and `queue::wait()` and `event::wait()` block until it has completed. Host accessors,
+/// buffer destruction and synchronous submissions first wait for all pending asynchronous commands.
+///
+/// The command group function itself executes on the background thread, so anything it captures by reference must
+/// remain alive until its command has completed. Queue shortcuts that take reductions always execute synchronously.
+/// Exceptions thrown by asynchronous commands are passed to the async handler of their queue on
+/// `queue::wait_and_throw()` or `queue::throw_asynchronous()`. Must not be called from within a kernel.
+void set_async_queue_submission(bool enable);
+
+/// Return whether ND-range kernels resume the work items of one concurrent group back to back on this thread.
+bool get_group_major_resume_order();
+
+/// Enable or disable group-major resume order for future ND-range kernel invocations on this thread.
+///
+/// By default, the active `cooperative_schedule` orders all concurrently executing work items across groups, so that
+/// e.g. a `shuffle_schedule` interleaves the items of different groups. In group-major order, concurrent groups are
+/// resumed one after another, each in the order prescribed by the schedule for a single group. This preserves fuzzing
+/// of the order within each group, but improves the locality of local memory and group state. Must not be called from
+/// within a kernel.
+void set_group_major_resume_order(bool enable);
+
+/// How joint group algorithms such as `joint_reduce` verify that all work items of a group compute the same result.
+enum class joint_algorithm_verification {
+    /// Every work item computes the result and compares it to that of the first item (the default).
+    all_work_items,
+    /// Only the first and the last work item to reach a joint algorithm compute its result.
+    sampled,
+    /// Only the first work item to reach a joint algorithm computes its result and shares it with the group.
+    none,
+};
+
+/// Return the thread-locally active verification mode for joint group algorithms.
+joint_algorithm_verification get_joint_algorithm_verification();
+
+/// Set the thread-locally active verification mode for joint group algorithms in future kernel invocations.
+///
+/// Joint algorithms operate on a range shared by all work items of the group, and SYCL requires all items to pass the
+/// same range and an equivalent predicate or function object. Computing the result in every work item checks this
+/// requirement, but costs one pass over the range per item. Must not be called from within a kernel.
+void set_joint_algorithm_verification(joint_algorithm_verification verification);
+
+/// When atomic operations and fences in ND-range kernels yield to the kernel scheduler, which lets other work items of
+/// the same thread make progress.
+enum class atomic_yield_policy {
+    /// Yield after every atomic operation and fence (the default).
+    always,
+    /// Yield after every `threshold`-th atomic operation or fence on this thread.
+    interval,
+    /// Only yield once a work item spins on atomic values. Fences, which might order plain loads in a wait loop, yield
+    /// after every `threshold`-th fence as under `interval`.
+    on_spin,
+    /// Never yield from atomic operations and fences. Kernels that spin-wait on other work items will not terminate.
+    never,
+};
+
+/// Threshold of the atomic yield policy unless configured otherwise.
+inline constexpr size_t default_atomic_yield_threshold = 64;
+
+/// Return the thread-locally active yield policy for atomic operations.
+atomic_yield_policy get_atomic_yield_policy();
+
+/// Return the thread-locally active threshold of the atomic yield policy.
+size_t get_atomic_yield_threshold();
+
+/// Set the thread-locally active yield policy for atomic operations in future kernel invocations.
+///
+/// Every yield is a fiber context switch, which dominates the run time of kernels performing many atomic operations,
+/// such as histograms. Unless the policy is `never`, a work item whose atomic reads returned an unchanged value
+/// `threshold` times in a row is considered to be spinning and suspends until other work items have made progress.
+/// Values are tracked for the four addresses read last, so wait loops may poll more than one atomic.
+/// Atomics on `memory_scope::work_item` never yield. Must not be called from within a kernel.
+void set_atomic_yield_policy(atomic_yield_policy policy, size_t threshold = default_atomic_yield_threshold);
+
+/// Largest number of ND-range work items that execute concurrently when the number of concurrent work groups follows
+/// the simulated device.
+inline constexpr size_t default_max_concurrent_work_items = 16 << 10;
+
+/// Return the thread-locally active fiber budget, i.e. the number of ND-range work items executing concurrently, or
+/// `std::nullopt` if the number of concurrent work groups follows the simulated device.
+std::optional<size_t> get_fiber_budget();
+
+/// Set the thread-locally active fiber budget for future ND-range kernel invocations.
+///
+/// Every concurrently executing work item is backed by a fiber with its own stack. Work groups always execute with all
+/// of their items at once, but only a limited number of groups execute concurrently, with further groups re-using
+/// their fibers once they complete. Without a budget (the default), up to `max_compute_units` groups of the device
+/// execute concurrently, as long as they have no more than `default_max_concurrent_work_items` items in total. A budget
+/// replaces this limit independently of the device configuration, so that large simulated devices do not exhaust host
+/// memory and small ones still interleave multiple groups. At least one group executes at a time regardless of the
+/// budget. Must not be called from within a kernel.
+void set_fiber_budget(std::optional<size_t> max_concurrent_work_items);
+
+/// Stack size of ND-range kernel fibers unless configured otherwise.
+inline constexpr size_t default_fiber_stack_size = 128 << 10;
+
+/// Smallest permitted stack size of ND-range kernel fibers.
+inline constexpr size_t min_fiber_stack_size = 16 << 10;
+
+/// Return the thread-locally active stack size for ND-range kernel fibers.
+size_t get_fiber_stack_size();
+
+/// Set the thread-locally active stack size for ND-range kernel fibers in future kernel invocations.
+///
+/// Every concurrently executing work item owns one stack of this size, which is followed by a guard page so that a
+/// stack overflow results in a segmentation fault instead of silent memory corruption. Must not be called from within a
+/// kernel.
+void set_fiber_stack_size(size_t size_bytes);
+
+/// Return whether the peak stack usage of ND-range kernel fibers is tracked for future kernel invocations on this
+/// thread.
+bool get_fiber_stack_usage_tracking();
+
+/// Enable or disable tracking of peak fiber stack usage for future kernel invocations on this thread.
+///
+/// Tracking inspects the stack of each fiber as it exits, which is expensive for large stack sizes. Recorded usage is
+/// available through `get_fiber_stack_usage`, and is only printed to stderr at program exit if tracking was enabled
+/// through `SIMSYCL_FIBER_STACK_REPORT`. Must not be called from within a kernel.
+void set_fiber_stack_usage_tracking(bool enable);
+
+/// Peak fiber stack usage observed for a kernel.
+struct fiber_stack_usage {
+    std::string kernel_name;
+    /// Largest stack size the kernel has been launched with.
+    size_t stack_size = 0;
+    /// Largest number of bytes used by any work item of the kernel.
+    size_t peak_usage = 0;
+};
+
+/// Return the peak stack usage of all kernels launched while usage tracking was enabled, in order of first launch.
+std::vector<fiber_stack_usage> get_fiber_stack_usage();
+
+/// Counters for the process-wide pool of fiber stacks that ND-range kernels allocate for their concurrent work items.
+struct fiber_stack_pool_statistics {
+    /// Number of stacks that were re-used from a previous kernel launch.
+    size_t hits = 0;
+    /// Number of stacks that had to be newly allocated.
+    size_t misses = 0;
+};
+
+/// Return the cumulative fiber stack pool counters since program start.
+fiber_stack_pool_statistics get_fiber_stack_pool_statistics();
+
+/// Counters for the work-stealing scheduler that distributes chunks of basic `parallel_for` kernels and the work groups
+/// of hierarchical `parallel_for_work_group` kernels across worker threads.
+struct work_stealing_statistics {
+    /// Number of chunks or hierarchical work groups executed, whether by their initial owner or by a thief.
+    size_t chunks = 0;
+    /// Number of times a worker that ran out of chunks took over part of the remaining chunks of another worker.
+    size_t steals = 0;
+    /// Number of chunks taken over by all steals.
+    size_t stolen_chunks = 0;
+};
+
+/// Return the cumulative work-stealing counters since program start.
+///
+/// A high ratio of stolen to executed chunks indicates a skewed kernel, which may benefit from more worker threads or
+/// smaller chunks. Launches that run on a single thread are not counted.
+work_stealing_statistics get_work_stealing_statistics();
+
 } // namespace simsycl
+
+namespace simsycl::detail {
+
+// The thread-local settings that affect kernel execution, so that threads executing kernels on behalf of another
+// thread behave as if the kernel was launched there.
+struct kernel_settings {
+    std::shared_ptr<const cooperative_schedule> schedule;
+    size_t num_worker_threads = 1;
+    bool group_major_resume_order = false;
+    bool deterministic_reductions = false;
+    std::optional<size_t> fiber_budget;
+    joint_algorithm_verification joint_verification = joint_algorithm_verification::all_work_items;
+    atomic_yield_policy atomic_yield = atomic_yield_policy::always;
+    size_t atomic_yield_threshold = default_atomic_yield_threshold;
+    size_t fiber_stack_size = default_fiber_stack_size;
+    bool fiber_stack_usage_tracking = false;
+    int check_mode_override = 0;
+};
+
+kernel_settings get_kernel_settings();
+void set_kernel_settings(const kernel_settings &settings);
+
+// Construct the function-local statics used by kernel launches. Statics are destroyed in reverse order of construction,
+// so objects whose destructor may still launch kernels call this from their constructor to outlive none of them.
+void construct_kernel_launch_singletons();
+
+// Number of times ND-range work items have suspended on this thread since program start, for observing how often the
+// scheduler switches between them.
+size_t get_num_kernel_suspensions();
+
+} // namespace simsycl::detail
@@ -8,6 +8,7 @@
 #include "property.hh"
 #include "range.hh"
 
+#include "../detail/allocation.hh"
 #include "../detail/subscript.hh"
 #include "../detail/utils.hh"
 
@@ -161,6 +162,7 @@ class host_access_guard {
     ~host_access_guard() { m_validator->end_host_access(m_range); }
 
   private:
+    async_commands_barrier m_barrier; // host accessors observe the effects of all previously submitted commands
     system_lock m_lock;
     buffer_access_validator<Dimensions> *m_validator;
     accessed_range<Dimensions> m_range;
@@ -748,13 +750,14 @@ class local_accessor final : public simsycl::detail::property_interface {
     template<typename>
     friend struct std::hash;
 
-    void **m_allocation_ptr = nullptr;
+    detail::local_memory_slot *m_allocation_ptr = nullptr;
     sycl::range<Dimensions> m_range;
 
     id<Dimensions> get_offset() const { return {}; }
 
     inline DataT *get_allocation() const {
-        return m_allocation_ptr != nullptr ? static_cast<DataT *>(*m_allocation_ptr) : nullptr;
+        return m_allocation_ptr != nullptr ? static_cast<DataT *>(detail::get_local_memory_allocation(m_allocation_ptr))
+                                         : nullptr;
     }
 };
 
@@ -846,10 +849,11 @@ class local_accessor<DataT, 0> final : public simsycl::detail::property_interfac
     template<typename>
     friend struct std::hash;
 
-    void **m_allocation_ptr = nullptr;
+    detail::local_memory_slot *m_allocation_ptr = nullptr;
 
     inline DataT *get_allocation() const {
-        return m_allocation_ptr != nullptr ? static_cast<DataT *>(*m_allocation_ptr) : nullptr;
+        return m_allocation_ptr != nullptr ? static_cast<DataT *>(detail::get_local_memory_allocation(m_allocation_ptr))
+                                         : nullptr;
     }
 };
 
@@ -1439,6 +1443,7 @@ class accessor<DataT, 0, AccessMode, target::host_buffer, IsPlaceholder> : publi
     template<typename>
     friend struct std::hash;
 
+    detail::async_commands_barrier m_barrier; // must not hold the lock while pending commands execute
     detail::system_lock m_lock; // active host accessors must block command-group submission on other threads
     const detail::buffer_state<std::remove_const_t<DataT>, 1> *m_buffer = nullptr;
     std::shared_ptr<detail::host_access_guard<1>> m_access_guard;
@@ -1498,10 +1503,12 @@ class accessor<DataT, Dimensions, AccessMode, target::local, IsPlaceholder> fina
     template<typename>
     friend struct std::hash;
 
-    void **m_allocation_ptr;
+    detail::local_memory_slot *m_allocation_ptr;
     sycl::range<Dimensions> m_range;
 
-    inline DataT *get_allocation() const { return static_cast<DataT *>(*m_allocation_ptr); }
+    inline DataT *get_allocation() const {
+        return static_cast<DataT *>(detail::get_local_memory_allocation(m_allocation_ptr));
+    }
 };
 
 template<typename DataT, access_mode AccessMode, access::placeholder IsPlaceholder>
@@ -1538,9 +1545,11 @@ class accessor<DataT, 0, AccessMode, target::local, IsPlaceholder> final : publi
     template<typename>
     friend struct std::hash;
 
-    void **m_allocation_ptr;
+    detail::local_memory_slot *m_allocation_ptr;
 
-    inline DataT *get_allocation() const { return static_cast<DataT *>(*m_allocation_ptr); }
+    inline DataT *get_allocation() const {
+        return static_cast<DataT *>(detail::get_local_memory_allocation(m_allocation_ptr));
+    }
 };
 
 } // namespace simsycl::sycl
@@ -5,6 +5,18 @@
 #include <vector>
 
 
+namespace simsycl::sycl {
+
+class exception_list;
+
+}
+
+namespace simsycl::detail {
+
+sycl::exception_list make_exception_list(std::vector<std::exception_ptr> &&exceptions);
+
+}
+
 namespace simsycl::sycl {
 
 class exception_list : private std::vector<std::exception_ptr> {
@@ -21,6 +33,9 @@ class exception_list : private std::vector<std::exception_ptr> {
     using std::vector<std::exception_ptr>::size;
     iterator begin() const { return std::vector<std::exception_ptr>::begin(); }
     iterator end() const { return std::vector<std::exception_ptr>::end(); }
+
+  private:
+    friend exception_list detail::make_exception_list(std::vector<std::exception_ptr> &&exceptions);
 };
 
 using async_handler = std::function<void(sycl::exception_list)>;
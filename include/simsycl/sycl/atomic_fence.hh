@@ -3,15 +3,31 @@
 #include "enums.hh"
 #include "forward.hh"
 
+#include <atomic>
+
+
+namespace simsycl::detail {
+
+constexpr std::memory_order to_std_memory_order(const sycl::memory_order order) {
+    switch(order) {
+        case sycl::memory_order::relaxed: return std::memory_order_relaxed;
+        case sycl::memory_order::acquire: return std::memory_order_acquire;
+        case sycl::memory_order::release: return std::memory_order_release;
+        case sycl::memory_order::acq_rel: return std::memory_order_acq_rel;
+        default: return std::memory_order_seq_cst;
+    }
+}
+
+} // namespace simsycl::detail
 
 namespace simsycl::sycl {
 
 inline void atomic_fence(memory_order order, memory_scope scope) {
-    (void)order;
-    (void)scope;
+    // work items can execute on different worker threads, so ordering their memory accesses takes a hardware fence
+    if(order != memory_order::relaxed) { std::atomic_thread_fence(detail::to_std_memory_order(order)); }
     // Guarantee forward progress in kernels that use atomics for synchronization. It is somewhat unclear to me whether
     // that is strictly necessary if order == relaxed since that does not introduce any ordering.
-    detail::maybe_yield_to_kernel_scheduler();
+    detail::maybe_yield_after_atomic_fence(scope);
 }
 
 } // namespace simsycl::sycl
@@ -5,8 +5,10 @@
 
 #include "../detail/utils.hh"
 
+#include <atomic>
+#include <cstdint>
 #include <cstdlib>
-#include <utility>
+#include <cstring>
 
 
 namespace simsycl::detail {
@@ -36,28 +38,54 @@ struct memory_order_traits<memory_order::seq_cst> {
     static constexpr memory_order write_order = memory_order::seq_cst;
 };
 
+// Kernels can execute on multiple worker threads, so all operations are performed through std::atomic_ref. These
+// already order memory as requested, so instead of calling atomic_fence (which would add a hardware fence), operations
+// only yield to the kernel scheduler afterwards.
+
+// std::atomic_ref does not accept release semantics for loads (including failed compare-exchanges), nor acquire
+// semantics for stores
+constexpr std::memory_order to_std_load_order(const memory_order order) {
+    switch(order) {
+        case memory_order::relaxed:
+        case memory_order::release: return std::memory_order_relaxed;
+        case memory_order::acquire:
+        case memory_order::acq_rel: return std::memory_order_acquire;
+        default: return std::memory_order_seq_cst;
+    }
+}
+
+constexpr std::memory_order to_std_store_order(const memory_order order) {
+    switch(order) {
+        case memory_order::relaxed:
+        case memory_order::acquire: return std::memory_order_relaxed;
+        case memory_order::release:
+        case memory_order::acq_rel: return std::memory_order_release;
+        default: return std::memory_order_seq_cst;
+    }
+}
+
 template<typename T, memory_order DefaultOrder, memory_scope DefaultScope, sycl::access::address_space AddressSpace>
 class atomic_ref_base {
   public:
     using value_type = T;
 
-    static constexpr bool is_always_lock_free = true;
-    static constexpr size_t required_alignment = alignof(T);
+    static constexpr bool is_always_lock_free = std::atomic_ref<T>::is_always_lock_free;
+    static constexpr size_t required_alignment = std::atomic_ref<T>::required_alignment;
 
     static constexpr memory_order default_read_order = memory_order_traits<DefaultOrder>::read_order;
     static constexpr memory_order default_write_order = memory_order_traits<DefaultOrder>::write_order;
     static constexpr memory_order default_read_modify_write_order = DefaultOrder;
     static constexpr memory_scope default_scope = DefaultScope;
 
-    bool is_lock_free() const noexcept { return true; }
+    bool is_lock_free() const noexcept { return atomic().is_lock_free(); }
 
     explicit atomic_ref_base(T &ref) : m_ref(ref) {}
     atomic_ref_base(const atomic_ref_base &) noexcept = default;
     atomic_ref_base &operator=(const atomic_ref_base &) = delete;
 
     void store(T operand, memory_order order = default_write_order, memory_scope scope = default_scope) noexcept {
-        m_ref = operand;
-        atomic_fence(order, scope);
+        atomic().store(operand, to_std_store_order(order));
+        maybe_yield_after_atomic_operation(scope);
     }
 
     T operator=(T desired) noexcept {
@@ -66,55 +94,76 @@ class atomic_ref_base {
     }
 
     T load(memory_order order = default_read_order, memory_scope scope = default_scope) const noexcept {
-        atomic_fence(order, scope);
-        return m_ref;
+        const auto value = atomic().load(to_std_load_order(order));
+        yield_after_read(value, scope);
+        return value;
     }
 
     operator T() const noexcept { return load(); }
 
     T exchange(
         T operand, memory_order order = default_read_modify_write_order, memory_scope scope = default_scope) noexcept {
-        using std::swap;
-        swap(m_ref, operand);
-        atomic_fence(order, scope);
-        return operand;
+        const auto original = atomic().exchange(operand, to_std_memory_order(order));
+        yield_after_read(original, scope);
+        return original;
     }
 
     bool compare_exchange_weak(T &expected, T desired, memory_order success, memory_order failure,
         memory_scope scope = default_scope) noexcept {
-        return compare_exchange(expected, desired, success, failure, scope);
+        const bool exchanged = atomic().compare_exchange_weak(
+            expected, desired, to_std_memory_order(success), to_std_load_order(failure));
+        yield_after_compare_exchange(exchanged, expected, scope);
+        return exchanged;
     }
 
     bool compare_exchange_weak(T &expected, T desired, memory_order order = default_read_modify_write_order,
         memory_scope scope = default_scope) noexcept {
-        return compare_exchange(expected, desired, order, order, scope);
+        return compare_exchange_weak(expected, desired, order, order, scope);
     }
 
     bool compare_exchange_strong(T &expected, T desired, memory_order success, memory_order failure,
         memory_scope scope = default_scope) noexcept {
-        return compare_exchange(expected, desired, success, failure, scope);
+        const bool exchanged = atomic().compare_exchange_strong(
+            expected, desired, to_std_memory_order(success), to_std_load_order(failure));
+        yield_after_compare_exchange(exchanged, expected, scope);
+        return exchanged;
     }
 
     bool compare_exchange_strong(T &expected, T desired, memory_order order = default_read_modify_write_order,
         memory_scope scope = default_scope) noexcept {
-        return compare_exchange(expected, desired, order, order, scope);
+        return compare_exchange_strong(expected, desired, order, order, scope);
     }
 
   protected:
     T &m_ref;
 
+    std::atomic_ref<T> atomic() const noexcept { return std::atomic_ref<T>(m_ref); }
+
+    // there is no std::atomic_ref::fetch_min / fetch_max before C++26
+    template<typename Select>
+    T fetch_select(T operand, memory_order order, memory_scope scope, const Select &select) noexcept {
+        const auto ref = atomic();
+        auto original = ref.load(std::memory_order_relaxed);
+        while(!ref.compare_exchange_weak(original, select(original, operand), to_std_memory_order(order),
+            std::memory_order_relaxed)) {}
+        yield_after_read(original, scope);
+        return original;
+    }
+
+    // Spin-waits in kernels can use any operation that reads a value, so they all take part in spin detection
+    void yield_after_read(const T value, const memory_scope scope) const noexcept {
+        static_assert(sizeof(T) <= sizeof(uint64_t));
+        uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(T));
+        maybe_yield_after_atomic_read(scope, &m_ref, bits);
+    }
+
   private:
-    bool compare_exchange(
-        T &expected, T desired, memory_order success, memory_order failure, memory_scope scope) noexcept {
-        // TODO randomly fail a weak compare_exchange
-        if(m_ref == expected) {
-            m_ref = desired;
-            atomic_fence(success, scope);
-            return true;
+    void yield_after_compare_exchange(const bool exchanged, const T &expected, const memory_scope scope) noexcept {
+        if(exchanged) {
+            maybe_yield_after_atomic_operation(scope);
         } else {
-            expected = m_ref;
-            atomic_fence(failure, scope);
-            return false;
+            yield_after_read(expected, scope);
         }
     }
 };
@@ -179,58 +228,47 @@ class atomic_ref<Integral, DefaultOrder, DefaultScope, AddressSpace>
 
     Integral fetch_add(Integral operand, memory_order order = default_read_modify_write_order,
         memory_scope scope = default_scope) noexcept {
-        const auto original = m_ref;
-        m_ref += operand;
-        atomic_fence(order, scope);
+        const auto original = atomic().fetch_add(operand, detail::to_std_memory_order(order));
+        yield_after_read(original, scope);
         return original;
     }
 
     Integral fetch_sub(Integral operand, memory_order order = default_read_modify_write_order,
         memory_scope scope = default_scope) noexcept {
-        const auto original = m_ref;
-        m_ref -= operand;
-        atomic_fence(order, scope);
+        const auto original = atomic().fetch_sub(operand, detail::to_std_memory_order(order));
+        yield_after_read(original, scope);
         return original;
     }
 
     Integral fetch_and(Integral operand, memory_order order = default_read_modify_write_order,
         memory_scope scope = default_scope) noexcept {
-        const auto original = m_ref;
-        m_ref &= operand;
-        atomic_fence(order, scope);
+        const auto original = atomic().fetch_and(operand, detail::to_std_memory_order(order));
+        yield_after_read(original, scope);
         return original;
     }
 
     Integral fetch_or(Integral operand, memory_order order = default_read_modify_write_order,
         memory_scope scope = default_scope) noexcept {
-        const auto original = m_ref;
-        m_ref |= operand;
-        atomic_fence(order, scope);
+        const auto original = atomic().fetch_or(operand, detail::to_std_memory_order(order));
+        yield_after_read(original, scope);
         return original;
     }
 
     Integral fetch_xor(Integral operand, memory_order order = default_read_modify_write_order,
         memory_scope scope = default_scope) noexcept {
-        const auto original = m_ref;
-        m_ref ^= operand;
-        atomic_fence(order, scope);
+        const auto original = atomic().fetch_xor(operand, detail::to_std_memory_order(order));
+        yield_after_read(original, scope);
         return original;
     }
 
     Integral fetch_min(Integral operand, memory_order order = default_read_modify_write_order,
         memory_scope scope = default_scope) noexcept {
-        const auto original = m_ref;
-        m_ref = detail::min(m_ref, operand);
-        atomic_fence(order, scope);
-        return original;
+        return fetch_select(operand, order, scope, [](auto a, auto b) { return detail::min(a, b); });
     }
 
     Integral fetch_max(Integral operand, memory_order order = default_read_modify_write_order,
         memory_scope scope = default_scope) noexcept {
-        const auto original = m_ref;
-        m_ref = detail::max(m_ref, operand);
-        atomic_fence(order, scope);
-        return original;
+        return fetch_select(operand, order, scope, [](auto a, auto b) { return detail::max(a, b); });
     }
 
     Integral operator++(int) noexcept { return fetch_add(1); }
@@ -244,7 +282,9 @@ class atomic_ref<Integral, DefaultOrder, DefaultScope, AddressSpace>
     Integral operator^=(Integral operand) noexcept { return fetch_xor(operand) ^ operand; }
 
   private:
-    using base::m_ref;
+    using base::atomic;
+    using base::fetch_select;
+    using base::yield_after_read;
 };
 
 // Partial specialization for floating-point types
@@ -267,41 +307,35 @@ class atomic_ref<Floating, DefaultOrder, DefaultScope, AddressSpace>
 
     Floating fetch_add(Floating operand, memory_order order = default_read_modify_write_order,
         memory_scope scope = default_scope) noexcept {
-        const auto original = m_ref;
-        m_ref += operand;
-        atomic_fence(order, scope);
+        const auto original = atomic().fetch_add(operand, detail::to_std_memory_order(order));
+        yield_after_read(original, scope);
         return original;
     }
 
     Floating fetch_sub(Floating operand, memory_order order = default_read_modify_write_order,
         memory_scope scope = default_scope) noexcept {
-        const auto original = m_ref;
-        m_ref -= operand;
-        atomic_fence(order, scope);
+        const auto original = atomic().fetch_sub(operand, detail::to_std_memory_order(order));
+        yield_after_read(original, scope);
         return original;
     }
 
     Floating fetch_min(Floating operand, memory_order order = default_read_modify_write_order,
         memory_scope scope = default_scope) noexcept {
-        const auto original = m_ref;
-        m_ref = detail::min(m_ref, operand);
-        atomic_fence(order, scope);
-        return original;
+        return fetch_select(operand, order, scope, [](auto a, auto b) { return detail::min(a, b); });
     }
 
     Floating fetch_max(Floating operand, memory_order order = default_read_modify_write_order,
         memory_scope scope = default_scope) noexcept {
-        const auto original = m_ref;
-        m_ref = detail::max(m_ref, operand);
-        atomic_fence(order, scope);
-        return original;
+        return fetch_select(operand, order, scope, [](auto a, auto b) { return detail::max(a, b); });
     }
 
     Floating operator+=(Floating operand) noexcept { return fetch_add(operand) + operand; }
     Floating operator-=(Floating operand) noexcept { return fetch_sub(operand) - operand; }
 
   private:
-    using base::m_ref;
+    using base::atomic;
+    using base::fetch_select;
+    using base::yield_after_read;
 };
 
 // Partial specialization for pointers
@@ -323,17 +357,15 @@ class atomic_ref<T *, DefaultOrder, DefaultScope, AddressSpace>
 
     T *fetch_add(difference_type operand, memory_order order = default_read_modify_write_order,
         memory_scope scope = default_scope) noexcept {
-        const auto original = m_ref;
-        m_ref += operand;
-        atomic_fence(order, scope);
+        const auto original = atomic().fetch_add(operand, detail::to_std_memory_order(order));
+        yield_after_read(original, scope);
         return original;
     }
 
     T *fetch_sub(difference_type operand, memory_order order = default_read_modify_write_order,
         memory_scope scope = default_scope) noexcept {
-        const auto original = m_ref;
-        m_ref -= operand;
-        atomic_fence(order, scope);
+        const auto original = atomic().fetch_sub(operand, detail::to_std_memory_order(order));
+        yield_after_read(original, scope);
         return original;
     }
 
@@ -345,7 +377,8 @@ class atomic_ref<T *, DefaultOrder, DefaultScope, AddressSpace>
     T *operator-=(difference_type operand) noexcept { return fetch_sub(operand) - operand; }
 
   private:
-    using base::m_ref;
+    using base::atomic;
+    using base::yield_after_read;
 };
 
 } // namespace simsycl::sycl
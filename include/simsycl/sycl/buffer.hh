@@ -177,6 +177,7 @@ struct buffer_state {
     buffer_state &operator=(buffer_state &&) = delete;
 
     ~buffer_state() {
+        wait_for_async_commands(); // pending command groups may still access the buffer
         system_lock lock; // writeback must not overlap with command groups in other threads
         if(write_back_on_destruction.with(lock)) { write_back.with(lock)(data, range.size()); }
         deallocate(data, range.size());
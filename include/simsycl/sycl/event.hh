@@ -7,18 +7,59 @@
 #include "../detail/reference_type.hh"
 
 #include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 
 namespace simsycl::detail {
 
+struct queue_state;
+
+// Progress of a command that executes asynchronously on the background thread (see `set_async_queue_submission`).
+struct event_completion {
+    std::mutex mutex;
+    std::condition_variable status_changed;
+    sycl::info::event_command_status status = sycl::info::event_command_status::submitted;
+};
+
 struct event_state {
     std::chrono::steady_clock::time_point t_submit;
     std::chrono::steady_clock::time_point t_start;
     std::chrono::steady_clock::time_point t_end;
+    // nullptr for commands that have completed before their event was returned from the submission
+    std::shared_ptr<event_completion> completion;
+    // the queue an asynchronous command was submitted to, which receives its errors in `event::wait_and_throw()`
+    std::weak_ptr<const queue_state> queue;
 
     void start() { t_start = std::chrono::steady_clock::now(); }
 
+    sycl::info::event_command_status get_status() const {
+        if(completion == nullptr) return sycl::info::event_command_status::complete;
+        std::lock_guard lock(completion->mutex);
+        return completion->status;
+    }
+
+    void set_status(const sycl::info::event_command_status status) {
+        {
+            std::lock_guard lock(completion->mutex);
+            completion->status = status;
+        }
+        completion->status_changed.notify_all();
+    }
+
+    // also orders all timestamps before the caller
+    void wait() const {
+        if(completion == nullptr) return;
+        std::unique_lock lock(completion->mutex);
+        completion->status_changed.wait(
+            lock, [&] { return completion->status == sycl::info::event_command_status::complete; });
+    }
+
+    // passes all pending asynchronous errors of the submitting queue (if it still exists) to its async handler
+    void throw_asynchronous() const;
+
     [[nodiscard]] static event_state submit() {
         event_state status;
         status.t_submit = std::chrono::steady_clock::now();
@@ -41,7 +82,8 @@ namespace simsycl::sycl {
 
 class event : public detail::reference_type<event, detail::event_state> {
   public:
-    event() = default;
+    // a default-constructed event refers to a command that has already completed
+    event() : detail::reference_type<event, detail::event_state>(std::in_place) {}
 
     backend get_backend() const noexcept { return backend::simsycl; }
 
@@ -50,18 +92,27 @@ class event : public detail::reference_type<event, detail::event_state> {
         return {};
     }
 
-    void wait() {}
+    void wait() { state().wait(); }
 
-    static void wait(const std::vector<event> & /* event_list */) {}
+    static void wait(const std::vector<event> &event_list) {
+        for(auto &e : event_list) { e.state().wait(); }
+    }
 
-    void wait_and_throw() {}
+    // asynchronous errors are reported through the async handler of the queue the command was submitted to
+    void wait_and_throw() {
+        wait();
+        state().throw_asynchronous();
+    }
 
-    static void wait_and_throw(const std::vector<event> & /* event_list */) {}
+    static void wait_and_throw(const std::vector<event> &event_list) {
+        wait(event_list);
+        for(auto &e : event_list) { e.state().throw_asynchronous(); }
+    }
 
     template<typename Param>
     typename Param::return_type get_info() const {
         if constexpr(std::is_same_v<Param, info::event::command_execution_status>) {
-            return info::event_command_status::complete;
+            return state().get_status();
         } else {
             static_assert(detail::always_false<Param>, "Unknown event::get_info() parameter");
         }
@@ -74,6 +125,7 @@ class event : public detail::reference_type<event, detail::event_state> {
 
     template<typename Param>
     typename Param::return_type get_profiling_info() const {
+        state().wait();
         if constexpr(std::is_same_v<Param, info::event_profiling::command_submit>) {
             return detail::nanoseconds_since_epoch(state().t_submit);
         } else if constexpr(std::is_same_v<Param, info::event_profiling::command_start>) {
@@ -114,7 +166,7 @@ inline sycl::event event_state::end() {
 
 inline sycl::event event_state::instant() {
     const auto now = std::chrono::steady_clock::now();
-    return make_event(event_state{now, now, now});
+    return make_event(event_state{now, now, now, nullptr, {}});
 }
 
 } // namespace simsycl::detail
@@ -153,6 +153,7 @@ class system_lock;
 struct concurrent_nd_item;
 struct concurrent_group;
 struct concurrent_sub_group;
+class group_operation_history;
 
 using device_selector = std::function<int(const sycl::device &)>;
 
@@ -177,7 +178,9 @@ sycl::handler make_handler(const sycl::device &device);
 
 sycl::interop_handle make_interop_handle();
 
-void **require_local_memory(sycl::handler &cgh, size_t size, size_t align);
+struct local_memory_slot;
+
+local_memory_slot *require_local_memory(sycl::handler &cgh, size_t size, size_t align);
 
 struct event_state;
 
@@ -186,4 +189,9 @@ sycl::event make_event(std::shared_ptr<event_state> &&state);
 void yield_to_kernel_scheduler();
 void maybe_yield_to_kernel_scheduler();
 
+// apply the active atomic_yield_policy after an atomic operation or fence, or after an operation that read `value`
+void maybe_yield_after_atomic_operation(sycl::memory_scope scope);
+void maybe_yield_after_atomic_fence(sycl::memory_scope scope);
+void maybe_yield_after_atomic_read(sycl::memory_scope scope, const void *address, uint64_t value);
+
 } // namespace simsycl::detail
@@ -11,24 +11,11 @@ namespace simsycl::sycl {
 template<Group G, Pointer Ptr, typename Predicate>
     requires std::predicate<Predicate, std::remove_pointer_t<Ptr>>
 bool joint_any_of(G g, Ptr first, Ptr last, Predicate pred) {
-    // approach: perform the operation sequentially on all work items, confirm that they compute the same result
+    // approach: perform the operation sequentially and confirm that other work items compute the same result
     // (this is the closest we can easily get to verifying the standard requirement that
-    //  "pred must be an immutable callable with the same state for all work-items in group g")
-
-    bool result = false;
-    for(auto start = first; !result && start != last; ++start) { result = pred(*start); }
-
-    detail::perform_group_operation(g, detail::group_operation_id::joint_any_of,
-        detail::group_operation_spec{//
-            .init = [&]() { return std::make_unique<detail::group_joint_bool_op_data<Ptr>>(first, last, result); },
-            .reached =
-                [&](detail::group_joint_bool_op_data<Ptr> &per_op) {
-                    SIMSYCL_CHECK(per_op.first == first);
-                    SIMSYCL_CHECK(per_op.last == last);
-                    SIMSYCL_CHECK(per_op.result == result);
-                }});
-
-    return result;
+    //  "pred must be an immutable callable with the same state for all work items in group g")
+    return detail::joint_bool_op_impl(
+        g, detail::group_operation_id::joint_any_of, first, last, [&] { return std::any_of(first, last, pred); });
 }
 
 template<Group G, typename T, typename Predicate>
@@ -37,16 +24,17 @@ bool any_of_group(G g, T x, Predicate pred) {
     return detail::perform_group_operation(g, detail::group_operation_id::any_of,
         detail::group_operation_spec{//
             .init =
-                [&]() {
-                    auto per_op_data = std::make_unique<detail::group_bool_data>(g.get_local_range().size());
+                [&](detail::group_operation_arena &arena) {
+                    auto *per_op_data = arena.create<detail::group_bool_data>(arena, g.get_local_range().size());
                     per_op_data->values[g.get_local_linear_id()] = pred(x);
                     return per_op_data;
                 },
             .reached = [&](detail::group_bool_data &per_op) { per_op.values[g.get_local_linear_id()] = pred(x); },
-            .complete =
-                [&](detail::group_bool_data &per_op) {
-                    return std::any_of(per_op.values.begin(), per_op.values.end(), [](bool x) { return x; });
-                }});
+            .all_reached =
+                [](detail::group_bool_data &per_op) {
+                    per_op.result = std::any_of(per_op.values.begin(), per_op.values.end(), [](bool x) { return x; });
+                },
+            .complete = [](const detail::group_bool_data &per_op) { return per_op.result; }});
 }
 
 template<Group G>
@@ -59,18 +47,8 @@ bool any_of_group(G g, bool pred) {
 template<Group G, Pointer Ptr, typename Predicate>
     requires std::predicate<Predicate, std::remove_pointer_t<Ptr>>
 bool joint_all_of(G g, Ptr first, Ptr last, Predicate pred) {
-    bool result = true;
-    for(auto start = first; result && start != last; ++start) { result = pred(*start); }
-    detail::perform_group_operation(g, detail::group_operation_id::joint_all_of,
-        detail::group_operation_spec{//
-            .init = [&]() { return std::make_unique<detail::group_joint_bool_op_data<Ptr>>(first, last, result); },
-            .reached =
-                [&](detail::group_joint_bool_op_data<Ptr> &per_op) {
-                    SIMSYCL_CHECK(per_op.first == first);
-                    SIMSYCL_CHECK(per_op.last == last);
-                    SIMSYCL_CHECK(per_op.result == result);
-                }});
-    return result;
+    return detail::joint_bool_op_impl(
+        g, detail::group_operation_id::joint_all_of, first, last, [&] { return std::all_of(first, last, pred); });
 }
 
 template<Group G, typename T, typename Predicate>
@@ -79,16 +57,17 @@ bool all_of_group(G g, T x, Predicate pred) {
     return detail::perform_group_operation(g, detail::group_operation_id::all_of,
         detail::group_operation_spec{//
             .init =
-                [&]() {
-                    auto per_op_data = std::make_unique<detail::group_bool_data>(g.get_local_range().size());
+                [&](detail::group_operation_arena &arena) {
+                    auto *per_op_data = arena.create<detail::group_bool_data>(arena, g.get_local_range().size());
                     per_op_data->values[g.get_local_linear_id()] = pred(x);
                     return per_op_data;
                 },
             .reached = [&](detail::group_bool_data &per_op) { per_op.values[g.get_local_linear_id()] = pred(x); },
-            .complete =
-                [&](detail::group_bool_data &per_op) {
-                    return std::all_of(per_op.values.begin(), per_op.values.end(), [](bool x) { return x; });
-                }});
+            .all_reached =
+                [](detail::group_bool_data &per_op) {
+                    per_op.result = std::all_of(per_op.values.begin(), per_op.values.end(), [](bool x) { return x; });
+                },
+            .complete = [](const detail::group_bool_data &per_op) { return per_op.result; }});
 }
 
 template<Group G>
@@ -101,18 +80,8 @@ bool all_of_group(G g, bool pred) {
 template<Group G, Pointer Ptr, typename Predicate>
     requires std::predicate<Predicate, std::remove_pointer_t<Ptr>>
 bool joint_none_of(G g, Ptr first, Ptr last, Predicate pred) {
-    bool result = true;
-    for(auto start = first; result && start != last; ++start) { result = !pred(*start); }
-    detail::perform_group_operation(g, detail::group_operation_id::joint_none_of,
-        detail::group_operation_spec{//
-            .init = [&]() { return std::make_unique<detail::group_joint_bool_op_data<Ptr>>(first, last, result); },
-            .reached =
-                [&](detail::group_joint_bool_op_data<Ptr> &per_op) {
-                    SIMSYCL_CHECK(per_op.first == first);
-                    SIMSYCL_CHECK(per_op.last == last);
-                    SIMSYCL_CHECK(per_op.result == result);
-                }});
-    return result;
+    return detail::joint_bool_op_impl(
+        g, detail::group_operation_id::joint_none_of, first, last, [&] { return std::none_of(first, last, pred); });
 }
 
 template<Group G, typename T, typename Predicate>
@@ -121,16 +90,17 @@ bool none_of_group(G g, T x, Predicate pred) {
     return detail::perform_group_operation(g, detail::group_operation_id::none_of,
         detail::group_operation_spec{//
             .init =
-                [&]() {
-                    auto per_op_data = std::make_unique<detail::group_bool_data>(g.get_local_range().size());
+                [&](detail::group_operation_arena &arena) {
+                    auto *per_op_data = arena.create<detail::group_bool_data>(arena, g.get_local_range().size());
                     per_op_data->values[g.get_local_linear_id()] = pred(x);
                     return per_op_data;
                 },
             .reached = [&](detail::group_bool_data &per_op) { per_op.values[g.get_local_linear_id()] = pred(x); },
-            .complete =
-                [&](detail::group_bool_data &per_op) {
-                    return std::none_of(per_op.values.begin(), per_op.values.end(), [](bool x) { return x; });
-                }});
+            .all_reached =
+                [](detail::group_bool_data &per_op) {
+                    per_op.result = std::none_of(per_op.values.begin(), per_op.values.end(), [](bool x) { return x; });
+                },
+            .complete = [](const detail::group_bool_data &per_op) { return per_op.result; }});
 }
 
 template<Group G>
@@ -145,8 +115,9 @@ T shift_group_left(G g, T x, typename G::linear_id_type delta = 1) {
     return detail::perform_group_operation(g, detail::group_operation_id::shift_left,
         detail::group_operation_spec{//
             .init =
-                [&]() {
-                    auto per_op_data = std::make_unique<detail::group_shift_data<T>>(g.get_local_range().size(), delta);
+                [&](detail::group_operation_arena &arena) {
+                    auto *per_op_data
+                        = arena.create<detail::group_shift_data<T>>(arena, g.get_local_range().size(), delta);
                     per_op_data->values[g.get_local_linear_id()] = x;
                     return per_op_data;
                 },
@@ -171,8 +142,9 @@ T shift_group_right(G g, T x, typename G::linear_id_type delta = 1) {
     return detail::perform_group_operation(g, detail::group_operation_id::shift_right,
         detail::group_operation_spec{//
             .init =
-                [&]() {
-                    auto per_op_data = std::make_unique<detail::group_shift_data<T>>(g.get_local_range().size(), delta);
+                [&](detail::group_operation_arena &arena) {
+                    auto *per_op_data
+                        = arena.create<detail::group_shift_data<T>>(arena, g.get_local_range().size(), delta);
                     per_op_data->values[g.get_local_linear_id()] = x;
                     return per_op_data;
                 },
@@ -198,9 +170,9 @@ T permute_group_by_xor(G g, T x, typename G::linear_id_type mask) {
     return detail::perform_group_operation(g, detail::group_operation_id::permute_by_xor,
         detail::group_operation_spec{//
             .init =
-                [&]() {
-                    auto per_op_data
-                        = std::make_unique<detail::group_permute_data<T>>(g.get_local_range().size(), mask);
+                [&](detail::group_operation_arena &arena) {
+                    auto *per_op_data
+                        = arena.create<detail::group_permute_data<T>>(arena, g.get_local_range().size(), mask);
                     per_op_data->values[g.get_local_linear_id()] = x;
                     return per_op_data;
                 },
@@ -227,8 +199,8 @@ T select_from_group(G g, T x, typename G::id_type remote_local_id) {
     return detail::perform_group_operation(g, detail::group_operation_id::select,
         detail::group_operation_spec{//
             .init =
-                [&]() {
-                    auto per_op_data = std::make_unique<detail::group_select_data<T>>(g.get_local_range().size());
+                [&](detail::group_operation_arena &arena) {
+                    auto *per_op_data = arena.create<detail::group_select_data<T>>(arena, g.get_local_range().size());
                     per_op_data->values[g.get_local_linear_id()] = x;
                     return per_op_data;
                 },
@@ -247,20 +219,23 @@ template<Group G, Pointer Ptr, SyclFunctionObject Op>
 typename std::iterator_traits<Ptr>::value_type joint_reduce(G g, Ptr first, Ptr last, Op binary_op)
     requires(std::is_same_v<decltype(binary_op(*first, *first)), typename std::iterator_traits<Ptr>::value_type>)
 {
-    auto result = *first;
-    for(auto i = first + 1; first != last && i != last; ++i) { result = binary_op(result, *i); }
-    simsycl::detail::joint_reduce_impl(g, first, last, {}, result);
-    return result;
+    using value_type = typename std::iterator_traits<Ptr>::value_type;
+    return simsycl::detail::joint_reduce_impl(g, first, last, std::optional<value_type>{}, [&] {
+        auto result = *first;
+        for(auto i = first + 1; first != last && i != last; ++i) { result = binary_op(result, *i); }
+        return result;
+    });
 }
 
 template<Group G, Pointer Ptr, Fundamental T, SyclFunctionObject Op>
 T joint_reduce(G g, Ptr first, Ptr last, T init, Op binary_op)
     requires(std::is_same_v<decltype(binary_op(*first, *first)), T>)
 {
-    T result = init;
-    for(auto i = first; i != last; ++i) { result = binary_op(result, *i); }
-    simsycl::detail::joint_reduce_impl(g, first, last, {init}, result);
-    return result;
+    return simsycl::detail::joint_reduce_impl(g, first, last, std::optional<T>{init}, [&] {
+        T result = init;
+        for(auto i = first; i != last; ++i) { result = binary_op(result, *i); }
+        return result;
+    });
 }
 
 template<Group G, Fundamental T, SyclFunctionObject Op>
@@ -284,12 +259,12 @@ OutPtr joint_exclusive_scan(G g, InPtr first, InPtr last, OutPtr result, Op bina
     requires(std::is_same_v<decltype(binary_op(*first, *first)), typename std::iterator_traits<OutPtr>::value_type>)
 {
     using value_type = typename std::iterator_traits<OutPtr>::value_type;
-    std::vector<value_type> results(std::distance(first, last));
-    results[0] = known_identity_v<Op, value_type>;
-    for(auto i = 0u; i < results.size() - 1; ++i) { results[i + 1] = binary_op(results[i], first[i]); }
-    simsycl::detail::joint_scan_impl(
-        g, simsycl::detail::group_operation_id::joint_exclusive_scan, first, last, {}, results);
-    std::copy(results.cbegin(), results.cend(), result);
+    simsycl::detail::joint_scan_impl(g, simsycl::detail::group_operation_id::joint_exclusive_scan, first, last, result,
+        std::optional<value_type>{}, [&](std::span<value_type> results) {
+            if(results.empty()) return;
+            results[0] = known_identity_v<Op, value_type>;
+            for(auto i = 0u; i < results.size() - 1; ++i) { results[i + 1] = binary_op(results[i], first[i]); }
+        });
     return result;
 }
 
@@ -297,12 +272,12 @@ template<Group G, PointerToFundamental InPtr, PointerToFundamental OutPtr, Funda
 OutPtr joint_exclusive_scan(G g, InPtr first, InPtr last, OutPtr result, T init, Op binary_op)
     requires(std::is_same_v<decltype(binary_op(init, *first)), T>)
 {
-    std::vector<T> results(std::distance(first, last));
-    results[0] = init;
-    for(auto i = 0u; i < results.size() - 1; ++i) { results[i + 1] = binary_op(results[i], first[i]); }
-    simsycl::detail::joint_scan_impl(
-        g, simsycl::detail::group_operation_id::joint_exclusive_scan, first, last, {init}, results);
-    std::copy(results.cbegin(), results.cend(), result);
+    simsycl::detail::joint_scan_impl(g, simsycl::detail::group_operation_id::joint_exclusive_scan, first, last, result,
+        std::optional<T>{init}, [&](std::span<T> results) {
+            if(results.empty()) return;
+            results[0] = init;
+            for(auto i = 0u; i < results.size() - 1; ++i) { results[i + 1] = binary_op(results[i], first[i]); }
+        });
     return result;
 }
 
@@ -328,12 +303,12 @@ OutPtr joint_inclusive_scan(G g, InPtr first, InPtr last, OutPtr result, Op bina
     requires(std::is_same_v<decltype(binary_op(*first, *first)), typename std::iterator_traits<OutPtr>::value_type>)
 {
     using value_type = typename std::iterator_traits<OutPtr>::value_type;
-    std::vector<value_type> results(std::distance(first, last));
-    results[0] = *first;
-    for(auto i = 1u; i < results.size(); ++i) { results[i] = binary_op(results[i - 1], first[i]); }
-    simsycl::detail::joint_scan_impl(
-        g, simsycl::detail::group_operation_id::joint_inclusive_scan, first, last, {}, results);
-    std::copy(results.cbegin(), results.cend(), result);
+    simsycl::detail::joint_scan_impl(g, simsycl::detail::group_operation_id::joint_inclusive_scan, first, last, result,
+        std::optional<value_type>{}, [&](std::span<value_type> results) {
+            if(results.empty()) return;
+            results[0] = *first;
+            for(auto i = 1u; i < results.size(); ++i) { results[i] = binary_op(results[i - 1], first[i]); }
+        });
     return result;
 }
 
@@ -341,12 +316,12 @@ template<Group G, PointerToFundamental InPtr, PointerToFundamental OutPtr, Funda
 OutPtr joint_inclusive_scan(G g, InPtr first, InPtr last, OutPtr result, Op binary_op, T init)
     requires(std::is_same_v<decltype(binary_op(init, *first)), T>)
 {
-    std::vector<T> results(std::distance(first, last));
-    results[0] = binary_op(init, *first);
-    for(auto i = 1u; i < results.size(); ++i) { results[i] = binary_op(results[i - 1], first[i]); }
-    simsycl::detail::joint_scan_impl(
-        g, simsycl::detail::group_operation_id::joint_inclusive_scan, first, last, {init}, results);
-    std::copy(results.cbegin(), results.cend(), result);
+    simsycl::detail::joint_scan_impl(g, simsycl::detail::group_operation_id::joint_inclusive_scan, first, last, result,
+        std::optional<T>{init}, [&](std::span<T> results) {
+            if(results.empty()) return;
+            results[0] = binary_op(init, *first);
+            for(auto i = 1u; i < results.size(); ++i) { results[i] = binary_op(results[i - 1], first[i]); }
+        });
     return result;
 }
 
@@ -365,4 +340,36 @@ T inclusive_scan_over_group(G g, V x, Op binary_op, T init)
         g, simsycl::detail::group_operation_id::inclusive_scan, x, {init}, binary_op);
 }
 
+// deprecated sub_group member functions
+
+template<typename T, class BinaryOperation>
+T sub_group::reduce(T x, BinaryOperation op) const {
+    return reduce_over_group(*this, x, op);
+}
+
+template<typename T, class BinaryOperation>
+T sub_group::reduce(T x, T init, BinaryOperation op) const {
+    return reduce_over_group(*this, x, init, op);
+}
+
+template<typename T, class BinaryOperation>
+T sub_group::exclusive_scan(T x, BinaryOperation op) const {
+    return exclusive_scan_over_group(*this, x, op);
+}
+
+template<typename T, class BinaryOperation>
+T sub_group::exclusive_scan(T x, T init, BinaryOperation op) const {
+    return exclusive_scan_over_group(*this, x, init, op);
+}
+
+template<typename T, class BinaryOperation>
+T sub_group::inclusive_scan(T x, BinaryOperation op) const {
+    return inclusive_scan_over_group(*this, x, op);
+}
+
+template<typename T, class BinaryOperation>
+T sub_group::inclusive_scan(T x, T init, BinaryOperation op) const {
+    return inclusive_scan_over_group(*this, x, op, init);
+}
+
 } // namespace simsycl::sycl
@@ -4,8 +4,6 @@
 #include "simsycl/detail/group_operation_impl.hh"
 #include "simsycl/detail/nd_memory.hh"
 
-#include <memory>
-
 namespace simsycl::sycl {
 
 template<Group G, TriviallyCopyable T>
@@ -20,11 +18,9 @@ T group_broadcast(G g, T x, typename G::linear_id_type local_linear_id) {
     return perform_group_operation(g, detail::group_operation_id::broadcast,
         detail::group_operation_spec{//
             .init =
-                [&]() {
-                    auto per_op_data = std::make_unique<detail::group_broadcast_data<T>>();
-                    per_op_data->local_linear_id = local_linear_id;
-                    per_op_data->type = std::type_index(typeid(T));
-                    per_op_data->values.resize(g.get_local_range().size());
+                [&](detail::group_operation_arena &arena) {
+                    auto *per_op_data = arena.create<detail::group_broadcast_data<T>>(
+                        arena, g.get_local_range().size(), local_linear_id);
                     per_op_data->values[g.get_local_linear_id()] = x;
                     return per_op_data;
                 },
@@ -49,12 +45,21 @@ void group_barrier(G g, memory_scope fence_scope = G::fence_scope) {
     perform_group_operation(g, detail::group_operation_id::barrier,
         detail::group_operation_spec{//
             .init =
-                [&]() {
-                    auto per_op_data = std::make_unique<detail::group_barrier_data>();
-                    per_op_data->fence_scope = fence_scope;
-                    return per_op_data;
+                [&](detail::group_operation_arena &arena) {
+                    return arena.create<detail::group_barrier_data>(fence_scope);
                 },
             .reached = [&](detail::group_barrier_data &per_op) { SIMSYCL_CHECK(per_op.fence_scope == fence_scope); }});
 }
 
+// deprecated sub_group member functions
+
+inline void sub_group::barrier() const { group_barrier(*this); }
+
+inline void sub_group::barrier(access::fence_space /* space */) const { group_barrier(*this); }
+
+template<typename T>
+T sub_group::broadcast(T x, id<1> local_id) const {
+    return group_broadcast(*this, x, local_id);
+}
+
 } // namespace simsycl::sycl
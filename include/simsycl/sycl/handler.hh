@@ -237,7 +237,7 @@ class handler {
 
   private:
     friend handler simsycl::detail::make_handler(const sycl::device &device);
-    friend void **simsycl::detail::require_local_memory(handler &cgh, size_t size, size_t align);
+    friend detail::local_memory_slot *simsycl::detail::require_local_memory(handler &cgh, size_t size, size_t align);
 
     device m_device;
     std::vector<detail::local_memory_requirement> m_local_memory;
@@ -273,9 +273,11 @@ namespace simsycl::detail {
 
 inline sycl::handler make_handler(const sycl::device &device) { return sycl::handler(device); }
 
-inline void **require_local_memory(sycl::handler &cgh, const size_t size, const size_t align) {
-    cgh.m_local_memory.push_back(local_memory_requirement{std::make_unique<void *>(), size, align});
-    return cgh.m_local_memory.back().ptr.get();
+inline local_memory_slot *require_local_memory(sycl::handler &cgh, const size_t size, const size_t align) {
+    const auto index = cgh.m_local_memory.size();
+    cgh.m_local_memory.push_back(local_memory_requirement{
+        std::make_unique<local_memory_slot>(local_memory_slot{nullptr, index}), size, align});
+    return cgh.m_local_memory.back().slot.get();
 }
 
 } // namespace simsycl::detail
@@ -8,6 +8,7 @@
 
 #include "../detail/reference_type.hh"
 
+#include <string>
 #include <typeinfo>
 #include <vector>
 
@@ -447,6 +448,9 @@ namespace simsycl::detail {
 // apple std library has a bug where type_info for the same type don't compare equal across shared libraries
 const std::type_info &get_unnamed_kernel_name_type_info();
 
+// Kernel name for diagnostic output, which falls back to the kernel function type for unnamed kernels.
+std::string get_kernel_diagnostic_name(const std::type_info &pointer_to_name_type, const std::type_info &func_type);
+
 template<typename KernelName, typename KernelFunc>
 inline const sycl::kernel_id kernel_id_registration_v = register_kernel(typeid(KernelName *), typeid(KernelFunc));
 
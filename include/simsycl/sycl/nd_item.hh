@@ -21,6 +21,10 @@ struct concurrent_nd_item {
   public:
     detail::concurrent_group *concurrent_group = nullptr;
     nd_item_instance instance;
+    // the (sub-)group operation the item is suspended on, so that the scheduler can defer resuming it until the
+    // operation is complete or has been invalidated
+    group_operation_history *blocking_operations = nullptr;
+    size_t blocking_operation_index = 0;
 };
 
 template<int Dimensions>
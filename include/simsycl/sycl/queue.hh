@@ -95,7 +95,7 @@ class queue final : public detail::reference_type<queue, detail::queue_state>,
     device get_device() const;
 
 #if SIMSYCL_ENABLE_SYCL_KHR_QUEUE_FLUSH
-    void khr_flush() const { /* This is a no-op in SimSYCL due to its synchronous nature */ }
+    void khr_flush() const { /* This is a no-op in SimSYCL, asynchronous commands are started eagerly */ }
 #endif // SIMSYCL_ENABLE_SYCL_KHR_QUEUE_FLUSH
 
     bool is_in_order() const { return has_property<property::queue::in_order>(); }
@@ -108,12 +108,11 @@ class queue final : public detail::reference_type<queue, detail::queue_state>,
 
     template<typename T>
     event submit(T cgf) {
-        auto status = detail::event_state::submit();
-        detail::system_lock lock; // implicitly enforce dependency ordering by keeping a lock within every task
-        auto cgh = simsycl::detail::make_handler(get_device());
-        status.start();
-        cgf(cgh);
-        return status.end();
+        if(detail::submits_asynchronously()) {
+            // shared ownership makes move-only command group functions storable in a std::function
+            return submit_async([cgf = std::make_shared<T>(std::move(cgf))](handler &cgh) { (*cgf)(cgh); });
+        }
+        return submit_synchronously(cgf);
     }
 
     template<typename T>
@@ -123,27 +122,27 @@ class queue final : public detail::reference_type<queue, detail::queue_state>,
         return submit(cgf);
     }
 
-    void wait() {}
-    void wait_and_throw() {}
-    void throw_asynchronous() {}
+    void wait();
+    void wait_and_throw();
+    void throw_asynchronous();
 
     /* -- convenience shortcuts -- */
 
     template<typename KernelName = simsycl::detail::unnamed_kernel, typename KernelFunc>
     event single_task(const KernelFunc &kernel_func) {
-        return submit([&](handler &cgh) { cgh.single_task<KernelName>(kernel_func); });
+        return submit([=](handler &cgh) { cgh.single_task<KernelName>(kernel_func); });
     }
 
     template<typename KernelName = simsycl::detail::unnamed_kernel, typename KernelType>
     event single_task(event dep_event, const KernelType &kernel_func) {
         (void)dep_event;
-        return submit([&](handler &cgh) { cgh.single_task<KernelName>(kernel_func); });
+        return submit([=](handler &cgh) { cgh.single_task<KernelName>(kernel_func); });
     }
 
     template<typename KernelName = simsycl::detail::unnamed_kernel, typename KernelType>
     event single_task(const std::vector<event> &dep_events, const KernelType &kernel_func) {
         (void)dep_events;
-        return submit([&](handler &cgh) { cgh.single_task<KernelName>(kernel_func); });
+        return submit([=](handler &cgh) { cgh.single_task<KernelName>(kernel_func); });
     }
 
     template<typename KernelName = simsycl::detail::unnamed_kernel, typename... Rest,
@@ -249,107 +248,59 @@ class queue final : public detail::reference_type<queue, detail::queue_state>,
     /* -- USM functions -- */
 
     event memcpy(void *dest, const void *src, size_t num_bytes) {
-        auto status = detail::event_state::submit();
-        detail::system_lock lock; // implicitly enforce dependency ordering by keeping a lock within every task
-        status.start();
-        ::memcpy(dest, src, num_bytes);
-        return status.end();
+        return submit([=](handler &cgh) { cgh.memcpy(dest, src, num_bytes); });
     }
 
     event memcpy(void *dest, const void *src, size_t num_bytes, event /* dep_event */) {
-        auto status = detail::event_state::submit();
-        detail::system_lock lock; // implicitly enforce dependency ordering by keeping a lock within every task
-        status.start();
-        ::memcpy(dest, src, num_bytes);
-        return status.end();
+        return submit([=](handler &cgh) { cgh.memcpy(dest, src, num_bytes); });
     }
 
     event memcpy(void *dest, const void *src, size_t num_bytes, const std::vector<event> & /* dep_events */) {
-        auto status = detail::event_state::submit();
-        detail::system_lock lock; // implicitly enforce dependency ordering by keeping a lock within every task
-        status.start();
-        ::memcpy(dest, src, num_bytes);
-        return status.end();
+        return submit([=](handler &cgh) { cgh.memcpy(dest, src, num_bytes); });
     }
 
     template<typename T>
     event copy(const T *src, T *dest, size_t count) {
-        auto status = detail::event_state::submit();
-        detail::system_lock lock; // implicitly enforce dependency ordering by keeping a lock within every task
-        status.start();
-        std::copy_n(src, count, dest);
-        return status.end();
+        return submit([=](handler &cgh) { cgh.copy(src, dest, count); });
     }
 
     template<typename T>
     event copy(const T *src, T *dest, size_t count, event dep_event) {
         (void)(dep_event);
-        auto status = detail::event_state::submit();
-        detail::system_lock lock; // implicitly enforce dependency ordering by keeping a lock within every task
-        status.start();
-        std::copy_n(src, count, dest);
-        return status.end();
+        return submit([=](handler &cgh) { cgh.copy(src, dest, count); });
     }
 
     template<typename T>
     event copy(const T *src, T *dest, size_t count, const std::vector<event> &dep_events) {
         (void)(dep_events);
-        auto status = detail::event_state::submit();
-        detail::system_lock lock; // implicitly enforce dependency ordering by keeping a lock within every task
-        status.start();
-        std::copy_n(src, count, dest);
-        return status.end();
+        return submit([=](handler &cgh) { cgh.copy(src, dest, count); });
     }
 
     event memset(void *ptr, int value, size_t num_bytes) {
-        auto status = detail::event_state::submit();
-        detail::system_lock lock; // implicitly enforce dependency ordering by keeping a lock within every task
-        status.start();
-        ::memset(ptr, value, num_bytes);
-        return status.end();
+        return submit([=](handler &cgh) { cgh.memset(ptr, value, num_bytes); });
     }
 
     event memset(void *ptr, int value, size_t num_bytes, event /* dep_event */) {
-        auto status = detail::event_state::submit();
-        detail::system_lock lock; // implicitly enforce dependency ordering by keeping a lock within every task
-        status.start();
-        ::memset(ptr, value, num_bytes);
-        return status.end();
+        return submit([=](handler &cgh) { cgh.memset(ptr, value, num_bytes); });
     }
 
     event memset(void *ptr, int value, size_t num_bytes, const std::vector<event> & /* dep_events */) {
-        auto status = detail::event_state::submit();
-        detail::system_lock lock; // implicitly enforce dependency ordering by keeping a lock within every task
-        status.start();
-        ::memset(ptr, value, num_bytes);
-        return status.end();
+        return submit([=](handler &cgh) { cgh.memset(ptr, value, num_bytes); });
     }
 
     template<typename T>
     event fill(void *ptr, const T &pattern, size_t count) {
-        auto status = detail::event_state::submit();
-        detail::system_lock lock; // implicitly enforce dependency ordering by keeping a lock within every task
-        status.start();
-        std::fill_n(static_cast<T *>(ptr), count, pattern);
-        return status.end();
+        return submit([=](handler &cgh) { cgh.fill(ptr, pattern, count); });
     }
 
     template<typename T>
     event fill(void *ptr, const T &pattern, size_t count, event /* dep_event */) {
-        auto status = detail::event_state::submit();
-        detail::system_lock lock; // implicitly enforce dependency ordering by keeping a lock within every task
-        status.start();
-        std::fill_n(static_cast<T *>(ptr), count, pattern);
-        return status.end();
+        return submit([=](handler &cgh) { cgh.fill(ptr, pattern, count); });
     }
 
     template<typename T>
     event fill(void *ptr, const T &pattern, size_t count, const std::vector<event> & /* dep_events */) {
-        auto status = detail::event_state::submit();
-        detail::system_lock lock; // implicitly enforce dependency ordering by keeping a lock within every task
-        status.start();
-        std::fill_n(static_cast<T *>(ptr), count, pattern);
-        return status.end();
+        return submit([=](handler &cgh) { cgh.fill(ptr, pattern, count); });
     }
 
     event prefetch(void * /* ptr */, size_t /* num_bytes */) { return detail::event_state::instant(); }
@@ -468,16 +419,43 @@ class queue final : public detail::reference_type<queue, detail::queue_state>,
     explicit queue(internal_t /* tag */, const context &sycl_context, const device &sycl_device,
         const async_handler &async_handler, const property_list &prop_list);
 
+    template<typename T>
+    event submit_synchronously(T &cgf) {
+        detail::wait_for_async_commands();
+        auto status = detail::event_state::submit();
+        detail::system_lock lock; // implicitly enforce dependency ordering by keeping a lock within every task
+        auto cgh = simsycl::detail::make_handler(get_device());
+        status.start();
+        cgf(cgh);
+        return status.end();
+    }
+
+    // The command group may execute after the shortcut has returned, so the kernel must be captured by value. Reducers
+    // are neither copyable nor movable, which forces shortcuts with reductions to execute synchronously.
     template<typename KernelName, int Dims, typename... Rest, std::enable_if_t<(sizeof...(Rest) > 0), int> = 0>
     event simple_parallel_for(range<Dims> num_work_items, Rest &&...rest) {
-        return submit([&](handler &cgh) { cgh.parallel_for<KernelName>(num_work_items, std::forward<Rest>(rest)...); });
+        if constexpr((std::is_copy_constructible_v<std::remove_cvref_t<Rest>> && ...)) {
+            return submit([num_work_items, ... rest = std::forward<Rest>(rest)](
+                              handler &cgh) mutable { cgh.parallel_for<KernelName>(num_work_items, rest...); });
+        } else {
+            auto cgf = [&](handler &cgh) { cgh.parallel_for<KernelName>(num_work_items, std::forward<Rest>(rest)...); };
+            return submit_synchronously(cgf);
+        }
     }
 
     template<typename KernelName, int Dims, typename... Rest, std::enable_if_t<(sizeof...(Rest) > 0), int> = 0>
     event parallel_for_nd_range(nd_range<Dims> execution_range, Rest &&...rest) {
-        return submit(
-            [&](handler &cgh) { cgh.parallel_for<KernelName>(execution_range, std::forward<Rest>(rest)...); });
+        if constexpr((std::is_copy_constructible_v<std::remove_cvref_t<Rest>> && ...)) {
+            return submit([execution_range, ... rest = std::forward<Rest>(rest)](
+                              handler &cgh) mutable { cgh.parallel_for<KernelName>(execution_range, rest...); });
+        } else {
+            auto cgf
+                = [&](handler &cgh) { cgh.parallel_for<KernelName>(execution_range, std::forward<Rest>(rest)...); };
+            return submit_synchronously(cgf);
+        }
     }
+
+    event submit_async(std::function<void(handler &)> cgf);
 };
 
 } // namespace simsycl::sycl
@@ -8,6 +8,7 @@
 #include "../detail/check.hh"
 #include "../detail/subscript.hh"
 
+#include <deque>
 #include <span>
 
 
@@ -27,38 +28,7 @@ struct is_property<property::reduction::initialize_to_identity> : std::true_type
 namespace simsycl::detail {
 
 template<typename T, typename BinaryOperation, int Dimensions>
-class reducer {
-  public:
-    using value_type = T;
-    using binary_operation = BinaryOperation;
-    static constexpr int dimensions = Dimensions;
-
-    explicit reducer(T *value, BinaryOperation combiner) : m_dim0(value, combiner) {}
-
-    reducer(const reducer &) = delete;
-    reducer(reducer &&) = delete;
-    reducer &operator=(const reducer &) = delete;
-    reducer &operator=(reducer &&) = delete;
-
-    decltype(auto) operator[](size_t index) { return subscript<Dimensions>(*this, index); }
-
-    T identity() const
-        requires(sycl::has_known_identity_v<BinaryOperation, T>)
-    {
-        return sycl::known_identity_v<BinaryOperation, T>;
-    }
-
-  private:
-    template<int D, typename U, int S>
-    friend decltype(auto) subscript(U &, sycl::id<D>, size_t);
-
-    reducer<T, BinaryOperation, 0> m_dim0;
-
-    reducer<T, BinaryOperation, 0> &operator[](sycl::id<Dimensions> index) {
-        SIMSYCL_CHECK(index == sycl::id<Dimensions>{});
-        return m_dim0;
-    }
-};
+class reducer;
 
 template<typename T, typename BinaryOperation>
 class reducer<T, BinaryOperation, 0> {
@@ -69,13 +39,23 @@ class reducer<T, BinaryOperation, 0> {
 
     explicit reducer(T *value, BinaryOperation combiner) : m_value(value), m_combiner(combiner) {}
 
+    // Kernels executing on multiple threads combine into private reducers, which are merged into the shared one after
+    // the kernel has completed. A private reducer holds no value until its first combine, so no identity is required.
+    reducer(private_reducer_t /* tag */, const reducer &shared)
+        : m_value(&m_partial), m_combiner(shared.m_combiner), m_has_value(false) {}
+
     reducer(const reducer &) = delete;
     reducer(reducer &&) = delete;
     reducer &operator=(const reducer &) = delete;
     reducer &operator=(reducer &&) = delete;
 
     reducer &combine(const T &partial) {
-        *m_value = m_combiner(*m_value, partial);
+        if(m_has_value) [[likely]] {
+            *m_value = m_combiner(*m_value, partial);
+        } else {
+            *m_value = partial;
+            m_has_value = true;
+        }
         return *this;
     }
 
@@ -85,52 +65,101 @@ class reducer<T, BinaryOperation, 0> {
         return sycl::known_identity_v<BinaryOperation, T>;
     }
 
+    // Combine the partial result of a private reducer into this one.
+    void merge(const reducer &other) {
+        if(other.m_has_value) { combine(*other.m_value); }
+    }
+
     friend reducer &operator+=(reducer &lhs, const T &rhs)
         requires(std::is_same_v<BinaryOperation, sycl::plus<>> || std::is_same_v<BinaryOperation, sycl::plus<T>>)
     {
-        *lhs.m_value += rhs;
-        return lhs;
+        return lhs.combine(rhs);
     }
 
     friend reducer &operator*=(reducer &lhs, const T &rhs)
         requires(
             std::is_same_v<BinaryOperation, sycl::multiplies<>> || std::is_same_v<BinaryOperation, sycl::multiplies<T>>)
     {
-        *lhs.m_value *= rhs;
-        return lhs;
+        return lhs.combine(rhs);
     }
 
     friend reducer &operator&=(reducer &lhs, const T &rhs)
         requires(std::is_same_v<BinaryOperation, sycl::bit_and<>> || std::is_same_v<BinaryOperation, sycl::bit_and<T>>)
     {
-        *lhs.m_value &= rhs;
-        return lhs;
+        return lhs.combine(rhs);
     }
 
     friend reducer &operator|=(reducer &lhs, const T &rhs)
         requires(std::is_same_v<BinaryOperation, sycl::bit_or<>> || std::is_same_v<BinaryOperation, sycl::bit_or<T>>)
     {
-        *lhs.m_value |= rhs;
-        return lhs;
+        return lhs.combine(rhs);
     }
 
     friend reducer &operator^=(reducer &lhs, const T &rhs)
         requires(std::is_same_v<BinaryOperation, sycl::bit_xor<>> || std::is_same_v<BinaryOperation, sycl::bit_xor<T>>)
     {
-        *lhs.m_value ^= rhs;
-        return lhs;
+        return lhs.combine(rhs);
     }
 
     friend reducer &operator++(reducer &lhs)
         requires(std::is_same_v<BinaryOperation, sycl::plus<>> || std::is_same_v<BinaryOperation, sycl::plus<T>>)
     {
-        ++*lhs.m_value;
-        return lhs;
+        return lhs.combine(T(1));
     }
 
   private:
     T *m_value;
     BinaryOperation m_combiner;
+    T m_partial{};
+    bool m_has_value = true;
+};
+
+// Reducer for span reductions, which combines each element independently.
+template<typename T, typename BinaryOperation, int Dimensions>
+class reducer {
+  public:
+    using value_type = T;
+    using binary_operation = BinaryOperation;
+    static constexpr int dimensions = Dimensions;
+    static_assert(Dimensions == 1, "reducers are either scalar or one-dimensional");
+
+    explicit reducer(T *values, size_t size, BinaryOperation combiner) {
+        for(size_t i = 0; i < size; ++i) { m_elements.emplace_back(values + i, combiner); }
+    }
+
+    reducer(private_reducer_t /* tag */, const reducer &shared) {
+        for(const auto &element : shared.m_elements) { m_elements.emplace_back(private_reducer, element); }
+    }
+
+    reducer(const reducer &) = delete;
+    reducer(reducer &&) = delete;
+    reducer &operator=(const reducer &) = delete;
+    reducer &operator=(reducer &&) = delete;
+
+    decltype(auto) operator[](size_t index) { return subscript<Dimensions>(*this, index); }
+
+    T identity() const
+        requires(sycl::has_known_identity_v<BinaryOperation, T>)
+    {
+        return sycl::known_identity_v<BinaryOperation, T>;
+    }
+
+    // Combine the partial results of a private reducer into this one.
+    void merge(const reducer &other) {
+        for(size_t i = 0; i < m_elements.size(); ++i) { m_elements[i].merge(other.m_elements[i]); }
+    }
+
+  private:
+    template<int D, typename U, int S>
+    friend decltype(auto) subscript(U &, sycl::id<D>, size_t);
+
+    // element reducers are neither copyable nor movable, so they are constructed in-place in a deque
+    std::deque<reducer<T, BinaryOperation, 0>> m_elements;
+
+    reducer<T, BinaryOperation, 0> &operator[](sycl::id<Dimensions> index) {
+        SIMSYCL_CHECK(index[0] < m_elements.size());
+        return m_elements[index[0]];
+    }
 };
 
 template<typename T, typename BinaryOperation>
@@ -175,7 +204,10 @@ auto reduction(T *var, BinaryOperation combiner, const property_list &prop_list
 
 template<typename T, size_t Extent, typename BinaryOperation>
     requires(Extent != std::dynamic_extent)
-auto reduction(span<T, Extent> vars, BinaryOperation combiner, const property_list &prop_list = {});
+auto reduction(span<T, Extent> vars, BinaryOperation combiner, const property_list &prop_list = {}) {
+    for(auto &var : vars) { detail::begin_reduction(&var, combiner, nullptr, prop_list); }
+    return detail::reducer<T, BinaryOperation, 1>(vars.data(), Extent, combiner);
+}
 
 // TODO in the spec, this simply accepts `typename BufferT` - is this more restrictive?
 template<typename T, int Dimensions, typename AllocatorT, typename BinaryOperation>
@@ -196,6 +228,9 @@ auto reduction(T *var, const T &identity, BinaryOperation combiner, const proper
 
 template<typename T, size_t Extent, typename BinaryOperation>
     requires(Extent != std::dynamic_extent)
-auto reduction(span<T, Extent> vars, const T &identity, BinaryOperation combiner, const property_list &prop_list = {});
+auto reduction(span<T, Extent> vars, const T &identity, BinaryOperation combiner, const property_list &prop_list = {}) {
+    for(auto &var : vars) { detail::begin_reduction(&var, combiner, &identity, prop_list); }
+    return detail::reducer<T, BinaryOperation, 1>(vars.data(), Extent, combiner);
+}
 
 } // namespace simsycl::sycl
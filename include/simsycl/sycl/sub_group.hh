@@ -34,55 +34,40 @@ class sub_group {
 
     // synchronization functions
 
-    SIMSYCL_DETAIL_DEPRECATED_IN_SYCL_V("use freestanding function group_barrier instead") void barrier() const {
-        SIMSYCL_NOT_IMPLEMENTED;
-    }
+    // these are defined in group_functions.hh and group_algorithms.hh on top of their freestanding counterparts
+    SIMSYCL_DETAIL_DEPRECATED_IN_SYCL_V("use freestanding function group_barrier instead") void barrier() const;
 
     SIMSYCL_DETAIL_DEPRECATED_IN_SYCL_V("use freestanding function group_barrier instead")
-    void barrier(access::fence_space space) const { SIMSYCL_NOT_IMPLEMENTED_UNUSED_ARGS(space); }
+    void barrier(access::fence_space space) const;
 
     // deprecated collective functions
     template<typename T>
     SIMSYCL_DETAIL_DEPRECATED_IN_SYCL_V("use freestanding function group_broadcast instead")
-    T broadcast(T x, id<1> local_id) const {
-        SIMSYCL_NOT_IMPLEMENTED_UNUSED_ARGS(x, local_id);
-    }
+    T broadcast(T x, id<1> local_id) const;
 
     template<typename T, class BinaryOperation>
     SIMSYCL_DETAIL_DEPRECATED_IN_SYCL_V("use freestanding function group_reduce instead")
-    T reduce(T x, BinaryOperation op) const {
-        SIMSYCL_NOT_IMPLEMENTED_UNUSED_ARGS(x, op);
-    }
+    T reduce(T x, BinaryOperation op) const;
 
     template<typename T, class BinaryOperation>
     SIMSYCL_DETAIL_DEPRECATED_IN_SYCL_V("use freestanding function group_reduce instead")
-    T reduce(T x, T init, BinaryOperation op) const {
-        SIMSYCL_NOT_IMPLEMENTED_UNUSED_ARGS(x, init, op);
-    }
+    T reduce(T x, T init, BinaryOperation op) const;
 
     template<typename T, class BinaryOperation>
     SIMSYCL_DETAIL_DEPRECATED_IN_SYCL_V("use freestanding function exclusive_scan_over_group instead")
-    T exclusive_scan(T x, BinaryOperation op) const {
-        SIMSYCL_NOT_IMPLEMENTED_UNUSED_ARGS(x, op);
-    }
+    T exclusive_scan(T x, BinaryOperation op) const;
 
     template<typename T, class BinaryOperation>
     SIMSYCL_DETAIL_DEPRECATED_IN_SYCL_V("use freestanding function exclusive_scan_over_group instead")
-    T exclusive_scan(T x, T init, BinaryOperation op) const {
-        SIMSYCL_NOT_IMPLEMENTED_UNUSED_ARGS(x, init, op);
-    }
+    T exclusive_scan(T x, T init, BinaryOperation op) const;
 
     template<typename T, class BinaryOperation>
     SIMSYCL_DETAIL_DEPRECATED_IN_SYCL_V("use freestanding function inclusive_scan_over_group instead")
-    T inclusive_scan(T x, BinaryOperation op) const {
-        SIMSYCL_NOT_IMPLEMENTED_UNUSED_ARGS(x, op);
-    }
+    T inclusive_scan(T x, BinaryOperation op) const;
 
     template<typename T, class BinaryOperation>
     SIMSYCL_DETAIL_DEPRECATED_IN_SYCL_V("use freestanding function inclusive_scan_over_group instead")
-    T inclusive_scan(T x, T init, BinaryOperation op) const {
-        SIMSYCL_NOT_IMPLEMENTED_UNUSED_ARGS(x, init, op);
-    }
+    T inclusive_scan(T x, T init, BinaryOperation op) const;
 
     linear_id_type get_group_linear_range() const { return m_group_range.size(); }
 
@@ -11,6 +11,8 @@
 namespace simsycl {
 
 class cooperative_schedule;
+enum class joint_algorithm_verification;
+enum class atomic_yield_policy;
 
 /// Identifier for `sycl::platform`s within a `system_config`.
 using platform_id = std::string;
@@ -153,6 +155,46 @@ void configure_system(const system_config &system);
 /// `round_robin_schedule` as a fallback.
 std::shared_ptr<const cooperative_schedule> get_default_cooperative_schedule();
 
+/// Return the number of OS threads to execute kernels on as specified by the environment via `SIMSYCL_THREADS`, or 1 as
+/// a fallback.
+size_t get_default_num_worker_threads();
+
+/// Return whether ND-range kernels resume work items in group-major order as specified by the environment via
+/// `SIMSYCL_GROUP_MAJOR`, or `false` as a fallback.
+bool get_default_group_major_resume_order();
+
+/// Return whether reductions are combined in a thread-count independent order as specified by the environment via
+/// `SIMSYCL_DETERMINISTIC_REDUCTIONS`, or `false` as a fallback.
+bool get_default_deterministic_reductions();
+
+/// Return the maximum number of concurrently executing ND-range work items as specified by the environment via
+/// `SIMSYCL_FIBER_BUDGET`, or `std::nullopt` to follow the simulated device as a fallback.
+std::optional<size_t> get_default_fiber_budget();
+
+/// Return the verification mode for joint group algorithms as specified by the environment via
+/// `SIMSYCL_JOINT_VERIFICATION`, or `joint_algorithm_verification::all_work_items` as a fallback.
+joint_algorithm_verification get_default_joint_algorithm_verification();
+
+/// Return the yield policy for atomic operations as specified by the environment via `SIMSYCL_ATOMIC_YIELD`, or
+/// `atomic_yield_policy::always` as a fallback.
+atomic_yield_policy get_default_atomic_yield_policy();
+
+/// Return the threshold of the atomic yield policy as specified by the environment via `SIMSYCL_ATOMIC_YIELD`, or
+/// `default_atomic_yield_threshold` as a fallback.
+size_t get_default_atomic_yield_threshold();
+
+/// Return the stack size for ND-range kernel fibers as specified by the environment via `SIMSYCL_FIBER_STACK_SIZE`, or
+/// `default_fiber_stack_size` as a fallback.
+size_t get_default_fiber_stack_size();
+
+/// Return whether peak fiber stack usage is tracked and reported at exit as specified by the environment via
+/// `SIMSYCL_FIBER_STACK_REPORT`, or `false` as a fallback.
+bool get_default_fiber_stack_usage_tracking();
+
+/// Return whether queues execute command groups asynchronously on a background thread as specified by the environment
+/// via `SIMSYCL_ASYNC`, or `false` as a fallback.
+bool get_default_async_queue_submission();
+
 } // namespace simsycl
 
 namespace simsycl::detail {
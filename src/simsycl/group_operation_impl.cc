@@ -1,7 +1,17 @@
 #include "simsycl/detail/group_operation_impl.hh"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
 namespace simsycl::detail {
 
+std::atomic<bool> g_record_group_operation_ids{false};
+
+void set_group_operation_id_recording(const bool enable) {
+    g_record_group_operation_ids.store(enable, std::memory_order_relaxed);
+}
+
 const char *group_operation_id_to_string(group_operation_id id) {
     switch(id) {
         case group_operation_id::broadcast: return "broadcast";
@@ -49,4 +59,101 @@ void check_group_op_validity(
     SIMSYCL_CHECK_MSG(existing_op.valid, "group operation already invalid");
 }
 
+void register_exited_work_items(group_operation_history &operations, const size_t expected_num_work_items,
+    const int first_linear_id_in_group, const size_t num_exited_work_items) {
+    if(num_exited_work_items == 0) return;
+
+    group_operation_data exit_op;
+    exit_op.id = group_operation_id::exit;
+    exit_op.expected_num_work_items = expected_num_work_items;
+    exit_op.num_work_items_participating = num_exited_work_items;
+    exit_op.valid = true;
+    if(operations.end_index() == 0) {
+        operations.push_back(exit_op);
+    } else {
+        auto &op = operations[0];
+        check_group_op_validity(first_linear_id_in_group, exit_op, op);
+        op.num_work_items_participating += num_exited_work_items;
+    }
+    // exited items have left the operation as well
+    operations.depart(0, num_exited_work_items);
+}
+
+void group_operation_history::push_back(const group_operation_data &op) {
+    if(m_end - m_begin == m_ring.size()) {
+        // grow, moving live operations to their positions modulo the new size
+        std::vector<entry> ring(std::max<size_t>(4, 2 * m_ring.size()));
+        for(size_t index = m_begin; index < m_end; ++index) {
+            ring[index & (ring.size() - 1)] = m_ring[index & (m_ring.size() - 1)];
+        }
+        m_ring = std::move(ring);
+    }
+    m_ring[m_end & (m_ring.size() - 1)] = entry{op, m_current_arena};
+    ++m_num_live_operations[m_current_arena];
+    ++m_end;
+    if(g_record_group_operation_ids.load(std::memory_order_relaxed)) { m_recorded_ids.push_back(op.id); }
+}
+
+void group_operation_history::depart(const size_t index, const size_t num_work_items) {
+    auto &op = (*this)[index];
+    op.num_work_items_departed += num_work_items;
+    while(m_begin < m_end) {
+        const auto &front = m_ring[m_begin & (m_ring.size() - 1)];
+        if(front.op.num_work_items_departed < front.op.expected_num_work_items) break;
+        --m_num_live_operations[front.arena];
+        ++m_begin;
+    }
+}
+
+void group_operation_history::reset() {
+    m_begin = 0;
+    m_end = 0;
+    m_arenas[0].reset();
+    m_arenas[1].reset();
+    m_num_live_operations[0] = 0;
+    m_num_live_operations[1] = 0;
+    m_current_arena = 0;
+    m_recorded_ids.clear();
+}
+
+void group_operation_arena::reset() {
+    for(auto it = m_destructors.rbegin(); it != m_destructors.rend(); ++it) { it->destroy(it->object); }
+    m_destructors.clear();
+    if(m_blocks.size() > 1) {
+        // replace the blocks by a single one large enough for everything allocated since the last reset
+        size_t total_size = 0;
+        for(const auto &[memory, size] : m_blocks) { total_size += size; }
+        m_blocks.clear();
+        m_blocks.emplace_back(std::make_unique<std::byte[]>(total_size), total_size);
+    }
+    m_current_block = 0;
+    m_current_offset = 0;
+}
+
+void *group_operation_arena::allocate(const size_t size, const size_t alignment) {
+    constexpr size_t min_block_size = 4096;
+    for(;;) {
+        if(m_current_block < m_blocks.size()) {
+            auto &[memory, block_size] = m_blocks[m_current_block];
+            const auto address = reinterpret_cast<uintptr_t>(memory.get()) + m_current_offset;
+            const auto padding = (alignment - address % alignment) % alignment;
+            if(m_current_offset + padding + size <= block_size) {
+                void *const ptr = memory.get() + m_current_offset + padding;
+                m_current_offset += padding + size;
+                return ptr;
+            }
+            if(m_current_block + 1 < m_blocks.size()) {
+                ++m_current_block;
+                m_current_offset = 0;
+                continue;
+            }
+        }
+        const auto new_block_size
+            = std::max({min_block_size, size + alignment, m_blocks.empty() ? 0 : 2 * m_blocks.back().second});
+        m_blocks.emplace_back(std::make_unique<std::byte[]>(new_block_size), new_block_size);
+        m_current_block = m_blocks.size() - 1;
+        m_current_offset = 0;
+    }
+}
+
 }; // namespace simsycl::detail
@@ -34,6 +34,14 @@ std::string get_kernel_name_string(const std::type_info &pointer_to_name_type) {
     }
 }
 
+std::string get_kernel_diagnostic_name(const std::type_info &pointer_to_name_type, const std::type_info &func_type) {
+    if(pointer_to_name_type == get_unnamed_kernel_name_type_info()) {
+        return "(unnamed kernel) " + demangle_name_from_pointer_type(func_type);
+    } else {
+        return demangle_name_from_pointer_type(pointer_to_name_type);
+    }
+}
+
 struct kernel_id_state {
     const std::type_info &pointer_to_name_type;
     const std::type_info &func_type;
@@ -3,15 +3,122 @@
 #include "simsycl/sycl/device.hh"
 #include "simsycl/sycl/info.hh"
 
+#include "simsycl/schedule.hh"
 #include "simsycl/system.hh"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 
 namespace simsycl::detail {
 
-struct queue_state {
+namespace {
+
+thread_local bool g_executing_async_commands = false;
+
+// updated under the executor mutex, but read without it to skip waiting when nothing was ever submitted asynchronously
+std::atomic<size_t> g_num_pending_async_commands{0};
+
+// Executes all asynchronously submitted command groups in submission order on a single background thread. Every
+// command group holds the system lock while it executes, so a second thread could not execute commands concurrently,
+// and the global order trivially satisfies all dependencies between commands, even across queues.
+class async_executor {
+  public:
+    // the destructor executes all pending commands, so it must run before the statics these depend on are destroyed
+    async_executor() { construct_kernel_launch_singletons(); }
+    async_executor(const async_executor &) = delete;
+    async_executor(async_executor &&) = delete;
+    async_executor &operator=(const async_executor &) = delete;
+    async_executor &operator=(async_executor &&) = delete;
+
+    ~async_executor() {
+        {
+            std::lock_guard lock(m_mutex);
+            m_shutdown = true;
+        }
+        m_command_available.notify_one();
+        if(m_thread.joinable()) { m_thread.join(); } // completes all pending commands first
+    }
+
+    static async_executor &get() {
+        static async_executor s_executor;
+        return s_executor;
+    }
+
+    void push(std::function<void()> command) {
+        {
+            std::lock_guard lock(m_mutex);
+            if(!m_thread.joinable()) { m_thread = std::thread([this] { work(); }); }
+            m_commands.push_back(std::move(command));
+            g_num_pending_async_commands.fetch_add(1, std::memory_order_relaxed);
+        }
+        m_command_available.notify_one();
+    }
+
+    void wait_until_idle() {
+        std::unique_lock lock(m_mutex);
+        m_idle.wait(lock, [] { return g_num_pending_async_commands.load(std::memory_order_relaxed) == 0; });
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::condition_variable m_command_available;
+    std::condition_variable m_idle;
+    std::deque<std::function<void()>> m_commands;
+    std::thread m_thread;
+    bool m_shutdown = false;
+
+    void work() {
+        g_executing_async_commands = true;
+        for(;;) {
+            std::function<void()> command;
+            {
+                std::unique_lock lock(m_mutex);
+                m_command_available.wait(lock, [this] { return m_shutdown || !m_commands.empty(); });
+                if(m_commands.empty()) return;
+                command = std::move(m_commands.front());
+                m_commands.pop_front();
+            }
+
+            command();
+            command = nullptr; // release captured buffers before reporting idle
+
+            {
+                std::lock_guard lock(m_mutex);
+                g_num_pending_async_commands.fetch_sub(1, std::memory_order_release);
+            }
+            m_idle.notify_all();
+        }
+    }
+};
+
+} // namespace
+
+bool submits_asynchronously() { return !g_executing_async_commands && get_async_queue_submission(); }
+
+void wait_for_async_commands() {
+    if(g_executing_async_commands || g_num_pending_async_commands.load(std::memory_order_acquire) == 0) return;
+    async_executor::get().wait_until_idle();
+}
+
+sycl::exception_list make_exception_list(std::vector<std::exception_ptr> &&exceptions) {
+    sycl::exception_list list;
+    static_cast<std::vector<std::exception_ptr> &>(list) = std::move(exceptions);
+    return list;
+}
+
+struct queue_state : std::enable_shared_from_this<queue_state> {
     sycl::device device;
     sycl::context context;
     sycl::async_handler async_handler;
+    // not protected by the system lock, which the background thread holds while executing a command
+    mutable std::mutex async_mutex;
+    mutable sycl::event last_async_event;
+    mutable std::vector<std::exception_ptr> async_exceptions;
 
     queue_state(const sycl::device &device, const sycl::async_handler &async_handler)
         : device(device), context(device, async_handler), async_handler(async_handler) {}
@@ -28,8 +135,21 @@ struct queue_state {
 
     queue_state(const device_selector &selector, const sycl::context &context, const sycl::async_handler &async_handler)
         : queue_state(select_device(selector), context, async_handler) {}
+
+    void throw_asynchronous() const {
+        std::vector<std::exception_ptr> exceptions;
+        {
+            std::lock_guard lock(async_mutex);
+            exceptions = std::exchange(async_exceptions, {});
+        }
+        if(!exceptions.empty()) { call_async_handler(async_handler, make_exception_list(std::move(exceptions))); }
+    }
 };
 
+void event_state::throw_asynchronous() const {
+    if(const auto state = queue.lock(); state != nullptr) { state->throw_asynchronous(); }
+}
+
 } // namespace simsycl::detail
 
 namespace simsycl::sycl {
@@ -69,4 +189,49 @@ context queue::get_context() const { return state().context; }
 
 device queue::get_device() const { return state().device; }
 
+event queue::submit_async(std::function<void(handler &)> cgf) {
+    auto status = std::make_shared<detail::event_state>(detail::event_state::submit());
+    status->completion = std::make_shared<detail::event_completion>();
+    status->queue = state().weak_from_this();
+    auto evt = detail::make_event(std::shared_ptr(status));
+    {
+        std::lock_guard lock(state().async_mutex);
+        state().last_async_event = evt;
+    }
+
+    detail::async_executor::get().push(
+        [queue = *this, status, cgf = std::move(cgf), settings = detail::get_kernel_settings()] {
+            detail::set_kernel_settings(settings);
+            detail::system_lock lock;
+            status->start();
+            status->set_status(info::event_command_status::running);
+            try {
+                auto cgh = detail::make_handler(queue.get_device());
+                cgf(cgh);
+            } catch(...) {
+                std::lock_guard async_lock(queue.state().async_mutex);
+                queue.state().async_exceptions.push_back(std::current_exception());
+            }
+            status->t_end = std::chrono::steady_clock::now();
+            status->set_status(info::event_command_status::complete);
+        });
+    return evt;
+}
+
+void queue::wait() {
+    event last_event;
+    {
+        std::lock_guard lock(state().async_mutex);
+        last_event = state().last_async_event;
+    }
+    last_event.wait();
+}
+
+void queue::wait_and_throw() {
+    wait();
+    throw_asynchronous();
+}
+
+void queue::throw_asynchronous() { state().throw_asynchronous(); }
+
 } // namespace simsycl::sycl
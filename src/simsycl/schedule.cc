@@ -1,4 +1,5 @@
 #include <simsycl/detail/utils.hh>
+#include <simsycl/detail/worker_pool.hh>
 #include <simsycl/schedule.hh>
 #include <simsycl/sycl/device.hh>
 #include <simsycl/sycl/exception.hh>
@@ -6,10 +7,18 @@
 #include <simsycl/sycl/handler.hh>
 #include <simsycl/system.hh>
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <iostream>
+#include <mutex>
 #include <numeric>
 #include <random>
+#include <unordered_map>
 
 #include <boost/context/continuation.hpp>
+#include <boost/context/protected_fixedsize_stack.hpp>
 
 namespace simsycl {
 
@@ -36,81 +45,115 @@ cooperative_schedule::state shuffle_schedule::update(state state_before, std::ve
     return rng();
 }
 
-} // namespace simsycl
+namespace {
 
-namespace simsycl::detail {
+// splitmix64 finalizer
+uint64_t mix_bits(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+    return x ^ (x >> 31);
+}
 
-template<int Dimensions, typename Offset>
-void sequential_for(const sycl::range<Dimensions> &range, const Offset &offset,
-    const simple_kernel<Dimensions, with_offset_v<Offset>> &kernel) {
-    // limit the number of work items scheduled at a time to avoid allocating huge index buffers
-    constexpr size_t max_schedule_chunk_size = 16 << 10;
-    const auto schedule_chunk_size = std::min(range.size(), max_schedule_chunk_size);
-    const auto &schedule = get_cooperative_schedule();
-    std::vector<size_t> order(schedule_chunk_size);
-    auto schedule_state = schedule.init(order);
+} // namespace
 
-    for(size_t schedule_offset = 0; schedule_offset < range.size(); schedule_offset += max_schedule_chunk_size) {
-        for(size_t schedule_id = 0; schedule_id < schedule_chunk_size; ++schedule_id) {
-            const auto linear_id = schedule_offset + order[schedule_id];
-            if(linear_id < range.size()) {
-                if constexpr(with_offset_v<Offset>) {
-                    const auto id = offset + linear_index_to_id(range, linear_id);
-                    kernel(make_item(id, range, offset));
-                } else {
-                    const auto id = linear_index_to_id(range, linear_id);
-                    kernel(make_item(id, range));
-                }
-            }
+cooperative_schedule::state permutation_schedule::init(std::vector<size_t> &order) const {
+    const auto round_state = init();
+    for(size_t i = 0; i < order.size(); ++i) { order[i] = get_index(round_state, order.size(), i); }
+    return round_state;
+}
+
+cooperative_schedule::state permutation_schedule::update(state state_before, std::vector<size_t> &order) const {
+    const auto round_state = update(state_before);
+    for(size_t i = 0; i < order.size(); ++i) { order[i] = get_index(round_state, order.size(), i); }
+    return round_state;
+}
+
+cooperative_schedule::state permutation_schedule::init() const { return mix_bits(m_seed); }
+
+cooperative_schedule::state permutation_schedule::update(state state_before) const {
+    return mix_bits(state_before + 0x9e3779b97f4a7c15);
+}
+
+size_t permutation_schedule::get_index(const state round_state, const size_t size, const size_t position) const {
+    SIMSYCL_CHECK(position < size);
+
+    // A balanced Feistel network permutes the smallest domain of 2^(2 * half_bits) indices that contains [0, size).
+    // Cycle-walking, i.e. re-applying the network until the result falls into [0, size), turns this into a permutation
+    // of [0, size). The domain is less than four times as large as the range, so few iterations are needed on average.
+    const auto half_bits = std::max(1, (static_cast<int>(std::bit_width(size - 1)) + 1) / 2);
+    const auto half_mask = (uint64_t{1} << half_bits) - 1;
+    constexpr uint64_t num_rounds = 4;
+
+    uint64_t index = position;
+    do {
+        auto left = index >> half_bits;
+        auto right = index & half_mask;
+        for(uint64_t round = 0; round < num_rounds; ++round) {
+            const auto next_right = left ^ (mix_bits(right + round_state + round) & half_mask);
+            left = right;
+            right = next_right;
         }
-        schedule_state = schedule.update(schedule_state, order);
-    }
+        index = (left << half_bits) | right;
+    } while(index >= size);
+    return index;
 }
 
-template void sequential_for(
-    const sycl::range<1> &range, const no_offset_t & /* no offset */, const simple_kernel<1, false> &kernel);
-template void sequential_for(
-    const sycl::range<2> &range, const no_offset_t & /* no offset */, const simple_kernel<2, false> &kernel);
-template void sequential_for(
-    const sycl::range<3> &range, const no_offset_t & /* no offset */, const simple_kernel<3, false> &kernel);
-template void sequential_for<1, sycl::id<1>>(
-    const sycl::range<1> &range, const sycl::id<1> &offset, const simple_kernel<1, true> &kernel);
-template void sequential_for(
-    const sycl::range<2> &range, const sycl::id<2> &offset, const simple_kernel<2, true> &kernel);
-template void sequential_for(
-    const sycl::range<3> &range, const sycl::id<3> &offset, const simple_kernel<3, true> &kernel);
+cooperative_schedule::state morton_schedule::init(std::vector<size_t> &order) const {
+    std::iota(order.begin(), order.end(), 0);
+    return 0;
+}
 
-template<int Dimensions>
-sycl::range<Dimensions> unit_range() {
-    sycl::range<Dimensions> r;
-    for(int i = 0; i < Dimensions; ++i) { r[i] = 1; }
-    return r;
+cooperative_schedule::state morton_schedule::update(state state_before, std::vector<size_t> &order) const {
+    (void)order;
+    return state_before;
 }
 
-template<int Dimensions>
-void sequential_for_work_group(sycl::range<Dimensions> num_work_groups,
-    std::optional<sycl::range<Dimensions>> work_group_size, const hierarchical_kernel<Dimensions> &kernel) {
-    const auto type
-        = work_group_size.has_value() ? group_type::hierarchical_explicit_size : group_type::hierarchical_implicit_size;
-    for(size_t group_linear_id = 0; group_linear_id < num_work_groups.size(); ++group_linear_id) {
-        const auto group_id = linear_index_to_id(num_work_groups, group_linear_id);
-        const auto group_item = make_item(group_id, num_work_groups);
-        const auto physical_local_item
-            = make_item(sycl::id<Dimensions>(), work_group_size.value_or(unit_range<Dimensions>()));
-        const auto global_item = make_item(group_id * sycl::id(physical_local_item.get_range()),
-            physical_local_item.get_range() * group_item.get_range(), sycl::id<Dimensions>());
-        kernel(make_group(type, physical_local_item, global_item, group_item, nullptr));
-    }
-}
-
-template void sequential_for_work_group(sycl::range<1> num_work_groups, std::optional<sycl::range<1>> work_group_size,
-    const hierarchical_kernel<1> &kernel);
-template void sequential_for_work_group(sycl::range<2> num_work_groups, std::optional<sycl::range<2>> work_group_size,
-    const hierarchical_kernel<2> &kernel);
-template void sequential_for_work_group(sycl::range<3> num_work_groups, std::optional<sycl::range<3>> work_group_size,
-    const hierarchical_kernel<3> &kernel);
+tiled_schedule::tiled_schedule(const size_t tile_size)
+    : cooperative_schedule(schedule_kind::tiled), m_tile_size(tile_size) {
+    SIMSYCL_CHECK(tile_size > 0 && "tile size must be positive");
+}
+
+cooperative_schedule::state tiled_schedule::init(std::vector<size_t> &order) const {
+    std::iota(order.begin(), order.end(), 0);
+    return 0;
+}
+
+cooperative_schedule::state tiled_schedule::update(state state_before, std::vector<size_t> &order) const {
+    (void)order;
+    return state_before;
+}
+
+} // namespace simsycl
+
+namespace simsycl::detail {
 
 thread_local boost::context::continuation g_scheduler;
+thread_local const std::vector<void *> *g_local_memory_bindings = nullptr;
+// counts suspensions of work items, which tell the barrier-free fast path that an item may wait for other items
+thread_local size_t g_num_kernel_suspensions = 0;
+
+size_t get_num_kernel_suspensions() { return g_num_kernel_suspensions; }
+
+// progress of the atomic yield policy on this thread
+thread_local size_t g_atomic_ops_since_yield = 0;
+// Spin detection state of the work item currently executing on this thread: the values last read from a few recently
+// read addresses, so that wait loops polling several atomics are recognized as well, and the number of consecutive
+// reads that returned the value last read from their address.
+struct atomic_spin_read {
+    const void *address = nullptr;
+    uint64_t value = 0;
+};
+constexpr size_t num_tracked_atomic_spin_reads = 4;
+thread_local std::array<atomic_spin_read, num_tracked_atomic_spin_reads> g_atomic_spin_reads;
+thread_local size_t g_atomic_spin_next_read = 0;
+thread_local size_t g_atomic_spin_count = 0;
+
+// Called whenever a work item starts or resumes, so that reads by other work items never count as the item spinning.
+void reset_atomic_spin_detection() {
+    g_atomic_spin_reads.fill(atomic_spin_read{});
+    g_atomic_spin_next_read = 0;
+    g_atomic_spin_count = 0;
+}
 
 void enter_kernel_fiber(boost::context::continuation &&from_scheduler) {
     assert(!g_scheduler && "attempting to enter a nd_range kernel fiber from within another fiber");
@@ -124,16 +167,865 @@ boost::context::continuation &&leave_kernel_fiber() {
 
 void yield_to_kernel_scheduler() {
     assert(g_scheduler && "attempting to yield from outside a nd_range kernel fiber");
+    ++g_num_kernel_suspensions;
     g_scheduler = g_scheduler.resume();
+    reset_atomic_spin_detection();
 }
 
 void maybe_yield_to_kernel_scheduler() {
-    if(g_scheduler) { g_scheduler = g_scheduler.resume(); }
+    // an atomic operation yielding is a suspension like any other: the work item might be spin-waiting on another one
+    if(g_scheduler) { yield_to_kernel_scheduler(); }
+}
+
+void maybe_yield_after_interval() {
+    if(++g_atomic_ops_since_yield >= get_atomic_yield_threshold()) {
+        g_atomic_ops_since_yield = 0;
+        yield_to_kernel_scheduler();
+    }
+}
+
+void maybe_yield_after_atomic_operation(const sycl::memory_scope scope) {
+    if(!g_scheduler || scope == sycl::memory_scope::work_item) return;
+    switch(get_atomic_yield_policy()) {
+        case atomic_yield_policy::always: yield_to_kernel_scheduler(); break;
+        case atomic_yield_policy::interval: maybe_yield_after_interval(); break;
+        case atomic_yield_policy::on_spin:
+        case atomic_yield_policy::never: break;
+    }
+}
+
+void maybe_yield_after_atomic_fence(const sycl::memory_scope scope) {
+    if(!g_scheduler || scope == sycl::memory_scope::work_item) return;
+    // fences can order plain loads in a wait loop, which spin detection does not observe
+    if(get_atomic_yield_policy() == atomic_yield_policy::on_spin) {
+        maybe_yield_after_interval();
+    } else {
+        maybe_yield_after_atomic_operation(scope);
+    }
+}
+
+void maybe_yield_after_atomic_read(const sycl::memory_scope scope, const void *const address, const uint64_t value) {
+    if(!g_scheduler || scope == sycl::memory_scope::work_item) return;
+    if(get_atomic_yield_policy() == atomic_yield_policy::never) return;
+    const auto read = std::find_if(g_atomic_spin_reads.begin(), g_atomic_spin_reads.end(),
+        [&](const atomic_spin_read &r) { return r.address == address; });
+    if(read != g_atomic_spin_reads.end() && read->value == value) {
+        if(++g_atomic_spin_count >= get_atomic_yield_threshold()) {
+            // the work item waits for another one to change one of the values
+            yield_to_kernel_scheduler();
+            return;
+        }
+    } else {
+        // the value has changed or is read for the first time, so the work item is making progress
+        auto &slot = read != g_atomic_spin_reads.end()
+            ? *read
+            : g_atomic_spin_reads[std::exchange(g_atomic_spin_next_read,
+                  (g_atomic_spin_next_read + 1) % num_tracked_atomic_spin_reads)];
+        slot = atomic_spin_read{address, value};
+        g_atomic_spin_count = 1;
+    }
+    maybe_yield_after_atomic_operation(scope);
+}
+
+// Whether a work item is suspended on a group operation that other items still need to enter, i.e. resuming it would
+// only make it yield again.
+bool is_blocked_on_group_operation(const concurrent_nd_item &item) {
+    if(item.blocking_operations == nullptr) return false;
+    const auto &op = (*item.blocking_operations)[item.blocking_operation_index];
+    return op.valid && op.num_work_items_participating < op.expected_num_work_items;
 }
 
+// Once no remaining work item can make progress, the kernel has diverged and the operations the items are blocked on
+// will never complete. Invalidating them has the items report the divergence when resumed instead of waiting forever.
+void invalidate_blocking_group_operation(const concurrent_nd_item &item) {
+    if(item.blocking_operations == nullptr) return;
+    (*item.blocking_operations)[item.blocking_operation_index].valid = false;
+}
+
+// Peak fiber stack usage per kernel, reported at program exit if requested through SIMSYCL_FIBER_STACK_REPORT.
+class fiber_stack_usage_registry {
+  public:
+    struct record {
+        fiber_stack_usage usage;
+        std::mutex mutex;
+    };
+
+    static fiber_stack_usage_registry &get() {
+        static fiber_stack_usage_registry s_registry;
+        return s_registry;
+    }
+
+    fiber_stack_usage_registry(const fiber_stack_usage_registry &) = delete;
+    fiber_stack_usage_registry(fiber_stack_usage_registry &&) = delete;
+    fiber_stack_usage_registry &operator=(const fiber_stack_usage_registry &) = delete;
+    fiber_stack_usage_registry &operator=(fiber_stack_usage_registry &&) = delete;
+
+    ~fiber_stack_usage_registry() {
+        if(!m_report_at_exit || m_records.empty()) return;
+        std::cerr << "SimSYCL peak fiber stack usage:\n";
+        for(const auto &usage : get_usage()) {
+            std::cerr << "  " << usage.peak_usage << " of " << usage.stack_size << " bytes: " << usage.kernel_name
+                      << "\n";
+        }
+    }
+
+    record &get_record(const std::string &kernel_name, const size_t stack_size) {
+        std::lock_guard lock(m_mutex);
+        const auto it = std::find_if(m_records.begin(), m_records.end(),
+            [&](const std::unique_ptr<record> &r) { return r->usage.kernel_name == kernel_name; });
+        auto &rec = it != m_records.end() ? **it : *m_records.emplace_back(std::make_unique<record>());
+        std::lock_guard record_lock(rec.mutex);
+        rec.usage.kernel_name = kernel_name;
+        rec.usage.stack_size = std::max(rec.usage.stack_size, stack_size);
+        return rec;
+    }
+
+    std::vector<fiber_stack_usage> get_usage() {
+        std::lock_guard lock(m_mutex);
+        std::vector<fiber_stack_usage> usage;
+        for(const auto &rec : m_records) {
+            std::lock_guard record_lock(rec->mutex);
+            usage.push_back(rec->usage);
+        }
+        return usage;
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::vector<std::unique_ptr<record>> m_records;
+    bool m_report_at_exit;
+
+    fiber_stack_usage_registry() : m_report_at_exit(get_default_fiber_stack_usage_tracking()) {}
+};
+
+// Fiber stacks are recycled across nd_range launches, since allocating and releasing one stack per concurrent work item
+// otherwise dominates the runtime of short kernels. Stacks are returned from whichever thread finished the fiber.
+//
+// Stacks are followed by a guard page to turn overflows into segmentation faults. Stack usage is measured by finding
+// the lowest non-zero word, so stacks handed out for tracked launches must be all-zero. Fresh mappings are zeroed by
+// the OS, and tracked fibers clear the part of the stack they used when exiting. Stacks that were used without tracking
+// are "dirty" and are only handed out to untracked launches.
+//
+// Whenever no stack of a size is in use, the pool releases the stacks of that size exceeding the largest number that
+// were in use at the same time since the size was last idle, so a single large launch does not pin its stacks forever.
+class fiber_stack_pool {
+  public:
+    static fiber_stack_pool &get() {
+        static fiber_stack_pool s_pool;
+        return s_pool;
+    }
+
+    fiber_stack_pool(const fiber_stack_pool &) = delete;
+    fiber_stack_pool(fiber_stack_pool &&) = delete;
+    fiber_stack_pool &operator=(const fiber_stack_pool &) = delete;
+    fiber_stack_pool &operator=(fiber_stack_pool &&) = delete;
+
+    ~fiber_stack_pool() {
+        for(auto &[size, stacks] : m_free_stacks) {
+            for(auto &stack : stacks.clean) { boost::context::protected_fixedsize_stack(size).deallocate(stack); }
+            for(auto &stack : stacks.dirty) { boost::context::protected_fixedsize_stack(size).deallocate(stack); }
+        }
+    }
+
+    boost::context::stack_context allocate(const size_t size, const bool require_clean) {
+        std::optional<boost::context::stack_context> unusable;
+        {
+            std::lock_guard lock(m_mutex);
+            auto &stacks = m_free_stacks[size];
+            stacks.peak_num_in_use = std::max(stacks.peak_num_in_use, ++stacks.num_in_use);
+            // prefer handing dirty stacks to untracked launches to preserve clean ones
+            auto &preferred = require_clean ? stacks.clean : stacks.dirty;
+            auto &fallback = require_clean ? stacks.dirty : stacks.clean;
+            if(!preferred.empty() || (!require_clean && !fallback.empty())) {
+                auto &from = !preferred.empty() ? preferred : fallback;
+                ++m_statistics.hits;
+                const auto stack = from.back();
+                from.pop_back();
+                return stack;
+            }
+            ++m_statistics.misses;
+            if(!fallback.empty()) {
+                // re-mapping a dirty stack is cheaper than clearing (and thereby committing) all of its pages
+                unusable = fallback.back();
+                fallback.pop_back();
+            }
+        }
+        if(unusable.has_value()) { boost::context::protected_fixedsize_stack(size).deallocate(*unusable); }
+        return boost::context::protected_fixedsize_stack(size).allocate();
+    }
+
+    void deallocate(const size_t size, const boost::context::stack_context &stack, const bool clean) {
+        std::vector<boost::context::stack_context> surplus;
+        {
+            std::lock_guard lock(m_mutex);
+            auto &stacks = m_free_stacks[size];
+            (clean ? stacks.clean : stacks.dirty).push_back(stack);
+            assert(stacks.num_in_use > 0);
+            if(--stacks.num_in_use == 0) {
+                // release dirty stacks first, since clean ones can serve tracked and untracked launches alike
+                while(stacks.clean.size() + stacks.dirty.size() > stacks.peak_num_in_use) {
+                    auto &from = !stacks.dirty.empty() ? stacks.dirty : stacks.clean;
+                    surplus.push_back(from.back());
+                    from.pop_back();
+                }
+                stacks.peak_num_in_use = 0;
+            }
+        }
+        for(auto &stack : surplus) { boost::context::protected_fixedsize_stack(size).deallocate(stack); }
+    }
+
+    fiber_stack_pool_statistics get_statistics() {
+        std::lock_guard lock(m_mutex);
+        return m_statistics;
+    }
+
+  private:
+    struct free_stacks {
+        std::vector<boost::context::stack_context> clean;
+        std::vector<boost::context::stack_context> dirty;
+        size_t num_in_use = 0;
+        size_t peak_num_in_use = 0;
+    };
+
+    std::mutex m_mutex;
+    std::unordered_map<size_t, free_stacks> m_free_stacks;
+    fiber_stack_pool_statistics m_statistics;
+
+    fiber_stack_pool() = default;
+};
+
+// Returns the number of bytes between the top of the stack and the lowest non-zero byte, and zeroes that range again.
+size_t measure_and_clear_stack_usage(const boost::context::stack_context &stack) {
+    // the lowest page of the mapping is the guard page
+    const auto guard_size = boost::context::stack_traits::page_size();
+    const auto top = static_cast<std::byte *>(stack.sp);
+    const auto bottom = top - stack.size + guard_size;
+    const auto first_used = std::find_if(reinterpret_cast<const uint64_t *>(bottom),
+        reinterpret_cast<const uint64_t *>(top), [](const uint64_t word) { return word != 0; });
+    const auto used = static_cast<size_t>(top - reinterpret_cast<const std::byte *>(first_used));
+    memset(top - used, 0, used);
+    return used;
+}
+
+// StackAllocator for boost::context::callcc drawing from the process-wide fiber_stack_pool. If a usage record is
+// given, the stack usage of the fiber is measured when it exits.
+class pooled_fixedsize_stack {
+  public:
+    explicit pooled_fixedsize_stack(const size_t size, fiber_stack_usage_registry::record *const usage = nullptr)
+        : m_size(size), m_usage(usage) {}
+
+    boost::context::stack_context allocate() const {
+        return fiber_stack_pool::get().allocate(m_size, m_usage != nullptr);
+    }
+
+    void deallocate(boost::context::stack_context &stack) const {
+        if(m_usage != nullptr) {
+            const auto used = measure_and_clear_stack_usage(stack);
+            std::lock_guard lock(m_usage->mutex);
+            m_usage->usage.peak_usage = std::max(m_usage->usage.peak_usage, used);
+        }
+        fiber_stack_pool::get().deallocate(m_size, stack, m_usage != nullptr);
+    }
+
+  private:
+    size_t m_size;
+    fiber_stack_usage_registry::record *m_usage;
+};
+
 template<int Dimensions>
-void cooperative_for_nd_range(const sycl::device &device, const sycl::nd_range<Dimensions> &range,
-    const std::vector<local_memory_requirement> &local_memory, const nd_kernel<Dimensions> &kernel) //
+struct nd_range_launch {
+    sycl::nd_range<Dimensions> range;
+    sycl::range<Dimensions> local_range;
+    size_t local_linear_range;
+    sycl::range<Dimensions> group_range;
+    size_t group_linear_range;
+    size_t sub_group_max_local_linear_range;
+    sycl::range<1> sub_group_max_local_range;
+    size_t sub_group_linear_range_in_group;
+    sycl::range<1> sub_group_range_in_group;
+    size_t num_concurrent_groups;
+    bool group_major_resume_order;
+    size_t fiber_stack_size;
+    fiber_stack_usage_registry::record *fiber_stack_usage;
+};
+
+// Group, sub-group and work-item state of the concurrent groups executed by one thread. Kept around between launches
+// of the same shape, see nd_range_plan_cache.
+template<int Dimensions>
+struct concurrent_work_items {
+    const nd_range_launch<Dimensions> &launch;
+    const std::vector<local_memory_requirement> *local_memory = nullptr;
+    size_t first_concurrent_group;
+    std::vector<concurrent_group> concurrent_groups;
+    std::vector<concurrent_sub_group> concurrent_sub_groups;
+    std::vector<concurrent_nd_item> concurrent_nd_items;
+
+    // Ids are tabulated once per launch (local ids) or once per group (group ids and the global id of the first item)
+    // so that make_nd_item does not need to divide linear indices for every work item.
+    std::vector<sycl::id<Dimensions>> local_ids;
+    std::vector<sycl::id<Dimensions>> group_ids;
+    std::vector<sycl::id<Dimensions>> group_global_offsets;
+
+    // when other threads execute groups of the same kernel concurrently, we cannot publish our allocations through the
+    // shared local memory slots, and instead bind them for the current thread only
+    bool bind_local_memory_to_thread;
+    std::vector<void *> local_memory_bindings;
+    std::optional<size_t> selected_concurrent_group;
+
+    concurrent_work_items(const nd_range_launch<Dimensions> &launch,
+        const std::vector<local_memory_requirement> &local_memory, const size_t first_concurrent_group,
+        const size_t num_concurrent_groups, const bool bind_local_memory_to_thread)
+        : launch(launch), first_concurrent_group(first_concurrent_group), concurrent_groups(num_concurrent_groups),
+          concurrent_sub_groups(num_concurrent_groups * launch.sub_group_linear_range_in_group),
+          concurrent_nd_items(num_concurrent_groups * launch.local_linear_range), group_ids(num_concurrent_groups),
+          group_global_offsets(num_concurrent_groups), bind_local_memory_to_thread(bind_local_memory_to_thread),
+          local_memory_bindings(bind_local_memory_to_thread ? local_memory.size() : 0) //
+    {
+        for(auto &cgroup : concurrent_groups) {
+            cgroup.local_memory_allocations.resize(local_memory.size());
+            for(size_t i = 0; i < local_memory.size(); ++i) {
+                cgroup.local_memory_allocations[i] = allocation(local_memory[i].size, local_memory[i].align);
+            }
+        }
+
+        local_ids.reserve(launch.local_linear_range);
+        for_each_id_in_range(launch.local_range, [&](const sycl::id<Dimensions> &id) { local_ids.push_back(id); });
+
+        for(size_t concurrent_local_idx = 0; concurrent_local_idx < concurrent_nd_items.size();
+            ++concurrent_local_idx) {
+            const auto local_linear_id = concurrent_local_idx % launch.local_linear_range;
+            const auto sub_group_linear_id_in_group = local_linear_id / launch.sub_group_max_local_linear_range;
+            const auto concurrent_local_group_idx = concurrent_local_idx / launch.local_linear_range;
+            const auto concurrent_sub_group_idx
+                = (concurrent_local_group_idx * launch.sub_group_linear_range_in_group) + sub_group_linear_id_in_group;
+
+            auto &concurrent_nd_item = concurrent_nd_items[concurrent_local_idx];
+            auto &concurrent_group = concurrent_groups[concurrent_local_group_idx];
+            concurrent_group.concurrent_nd_items.push_back(&concurrent_nd_item);
+            concurrent_nd_item.concurrent_group = &concurrent_group;
+            concurrent_sub_groups[concurrent_sub_group_idx].concurrent_nd_items.push_back(&concurrent_nd_item);
+        }
+    }
+
+    concurrent_work_items(const concurrent_work_items &) = delete;
+    concurrent_work_items(concurrent_work_items &&) = delete;
+    concurrent_work_items &operator=(const concurrent_work_items &) = delete;
+    concurrent_work_items &operator=(concurrent_work_items &&) = delete;
+    ~concurrent_work_items() = default;
+
+    // Attach to the local memory slots of a launch and forget about the groups of any previous launch. Local memory is
+    // not re-initialized, just like it isn't between groups executing one after the other within a launch.
+    void begin_launch(const std::vector<local_memory_requirement> &launch_local_memory) {
+        local_memory = &launch_local_memory;
+        selected_concurrent_group.reset();
+        std::fill(local_memory_bindings.begin(), local_memory_bindings.end(), nullptr);
+        for(auto &cgroup : concurrent_groups) { cgroup.instance.reset(); }
+        for(auto &csub_group : concurrent_sub_groups) { csub_group.instance.reset(); }
+    }
+
+    // adjust local memory pointers before switching to a fiber of another concurrent group
+    void select_local_memory(const size_t concurrent_local_group_idx) {
+        if(selected_concurrent_group == concurrent_local_group_idx) return;
+        selected_concurrent_group = concurrent_local_group_idx;
+
+        auto &concurrent_group = concurrent_groups[concurrent_local_group_idx];
+        for(size_t i = 0; i < local_memory->size(); ++i) {
+            if(bind_local_memory_to_thread) {
+                local_memory_bindings[i] = concurrent_group.local_memory_allocations[i].get();
+            } else {
+                (*local_memory)[i].slot->allocation = concurrent_group.local_memory_allocations[i].get();
+            }
+        }
+    }
+
+    // Prepare the state of a work item of `group_linear_id` executing on the concurrent item `concurrent_local_idx`.
+    sycl::nd_item<Dimensions> make_nd_item(const size_t group_linear_id, const size_t concurrent_local_idx) {
+        const auto &range = launch.range;
+        const auto &local_range = launch.local_range;
+        const auto local_linear_range = launch.local_linear_range;
+        const auto sub_group_max_local_linear_range = launch.sub_group_max_local_linear_range;
+        const auto sub_group_linear_range_in_group = launch.sub_group_linear_range_in_group;
+
+        const auto local_linear_id = concurrent_local_idx % local_linear_range;
+        const auto &local_id = local_ids[local_linear_id];
+        const auto sub_group_linear_id_in_group = local_linear_id / sub_group_max_local_linear_range;
+        const auto thread_linear_id_in_sub_group = local_linear_id % sub_group_max_local_linear_range;
+        const auto sub_group_id_in_group = sycl::id<1>(sub_group_linear_id_in_group);
+        const auto thread_id_in_sub_group = sycl::id<1>(thread_linear_id_in_sub_group);
+
+        const auto concurrent_local_group_idx = concurrent_local_idx / local_linear_range;
+        const auto concurrent_sub_group_idx
+            = (concurrent_local_group_idx * sub_group_linear_range_in_group) + sub_group_linear_id_in_group;
+        const auto sub_group_linear_id
+            = (group_linear_id * sub_group_linear_range_in_group) + sub_group_linear_id_in_group;
+
+        auto &concurrent_nd_item = concurrent_nd_items[concurrent_local_idx];
+        auto &concurrent_group = concurrent_groups[concurrent_local_group_idx];
+        auto &concurrent_sub_group = concurrent_sub_groups[concurrent_sub_group_idx];
+
+        concurrent_nd_item.instance = nd_item_instance{};
+        concurrent_nd_item.blocking_operations = nullptr;
+        // the first item to arrive in this group will create the new group instance
+        if(concurrent_group.instance.group_linear_id != group_linear_id) {
+            concurrent_group.instance.reset(group_linear_id);
+            group_ids[concurrent_local_group_idx] = linear_index_to_id(launch.group_range, group_linear_id);
+            SIMSYCL_START_IGNORING_DEPRECATIONS;
+            group_global_offsets[concurrent_local_group_idx]
+                = range.get_offset() + (group_ids[concurrent_local_group_idx] * sycl::id<Dimensions>(local_range));
+            SIMSYCL_STOP_IGNORING_DEPRECATIONS;
+        }
+        // the first item to arrive in this sub_group will create the new sub_group instance
+        if(concurrent_sub_group.instance.sub_group_linear_id != sub_group_linear_id) {
+            concurrent_sub_group.instance.reset(sub_group_linear_id);
+        }
+
+        const auto &group_id = group_ids[concurrent_local_group_idx];
+        const auto global_id = group_global_offsets[concurrent_local_group_idx] + local_id;
+
+        // if sub-group range is not divisible by local range, the last sub-group will be smaller
+        const auto sub_group_local_linear_range = std::min(sub_group_max_local_linear_range,
+            local_linear_range - (sub_group_linear_id_in_group * sub_group_max_local_linear_range));
+        const auto sub_group_local_range = sycl::range<1>(sub_group_local_linear_range);
+
+        SIMSYCL_START_IGNORING_DEPRECATIONS;
+        const auto global_item = detail::make_item(global_id, range.get_global_range(), range.get_offset());
+        SIMSYCL_STOP_IGNORING_DEPRECATIONS;
+        const auto local_item = detail::make_item(local_id, range.get_local_range());
+        const auto group_item = detail::make_item(group_id, range.get_group_range());
+
+        const auto group
+            = detail::make_group(group_type::nd_range, local_item, global_item, group_item, &concurrent_group);
+        const auto sub_group = detail::make_sub_group(thread_id_in_sub_group, sub_group_local_range,
+            launch.sub_group_max_local_range, sub_group_id_in_group, launch.sub_group_range_in_group,
+            &concurrent_sub_group);
+        return detail::make_nd_item(global_item, local_item, group, sub_group, &concurrent_nd_item);
+    }
+};
+
+// Fibers of run_concurrent_groups, one per concurrent work item. run_barrier_free hands its remaining work items over
+// to these when it can no longer execute groups one after the other.
+struct concurrent_item_fibers {
+    std::vector<boost::context::continuation> fibers;
+    std::vector<bool> created;
+    // the group whose remaining items each fiber waits for before advancing to its next group, if any
+    std::vector<std::optional<size_t>> awaited_group_exits;
+    // per concurrent group, the first group executed by fibers that are created from now on
+    std::vector<size_t> first_group_linear_ids;
+
+    concurrent_item_fibers(const size_t num_concurrent_items, const size_t num_concurrent_groups,
+        const size_t first_concurrent_group)
+        : fibers(num_concurrent_items), created(num_concurrent_items), awaited_group_exits(num_concurrent_items),
+          first_group_linear_ids(num_concurrent_groups) {
+        std::iota(first_group_linear_ids.begin(), first_group_linear_ids.end(), first_concurrent_group);
+    }
+};
+
+// Barrier-free fast path: the probe work item completed without suspending, so the remaining work items are executed as
+// plain function calls, one group at a time, from a single runner fiber. Should a work item suspend on a group
+// operation nevertheless (e.g. because only some groups synchronize), all not-yet-started items of its group receive
+// their own fiber, and the items that already exited are registered as having reached the implicit exit operation.
+//
+// A work item suspending on an atomic operation instead might wait for an item of another concurrent group, which the
+// runner would never get to. In that case, all remaining work items of all concurrent groups are handed over to the
+// fibers of run_concurrent_groups, which interleave the concurrent groups again.
+template<int Dimensions, typename InvokeKernel, typename PerformExitOperations, typename ContinueWithNextGroups,
+    typename RunFibers>
+void run_barrier_free(concurrent_work_items<Dimensions> &items, const InvokeKernel &invoke_kernel,
+    const PerformExitOperations &perform_exit_operations, const ContinueWithNextGroups &continue_with_next_groups,
+    concurrent_item_fibers &item_fibers, const RunFibers &run_fibers, const cooperative_schedule &schedule,
+    const pooled_fixedsize_stack &stack_allocator, const std::pair<size_t, size_t> &probe) //
+{
+    const auto &launch = items.launch;
+    const auto local_linear_range = launch.local_linear_range;
+    const auto sub_group_max_local_linear_range = launch.sub_group_max_local_linear_range;
+    const auto sub_group_linear_range_in_group = launch.sub_group_linear_range_in_group;
+    const auto num_local_concurrent_groups = items.concurrent_groups.size();
+
+    // position of the runner, shared with the scheduling loop
+    size_t group_linear_id = 0;
+    size_t concurrent_local_group_idx = 0;
+    size_t local_linear_id = 0;
+    std::optional<size_t> fallback_group_linear_id;
+    bool runner_awaits_group_exit = false;
+    bool handed_over = false;
+    std::vector<bool> items_started(local_linear_range);
+    std::vector<boost::context::continuation> fallback_fibers(local_linear_range);
+
+    std::vector<size_t> order(local_linear_range);
+    auto schedule_state = schedule.init(order);
+
+    const auto runner = [&](boost::context::continuation &&scheduler) {
+        enter_kernel_fiber(std::move(scheduler));
+
+        for(size_t first_group_in_wave = items.first_concurrent_group; first_group_in_wave < launch.group_linear_range;
+            first_group_in_wave += launch.num_concurrent_groups) //
+        {
+            for(concurrent_local_group_idx = 0; concurrent_local_group_idx < num_local_concurrent_groups
+                && first_group_in_wave + concurrent_local_group_idx < launch.group_linear_range;
+                ++concurrent_local_group_idx) //
+            {
+                group_linear_id = first_group_in_wave + concurrent_local_group_idx;
+                auto &concurrent_group = items.concurrent_groups[concurrent_local_group_idx];
+                items.select_local_memory(concurrent_local_group_idx);
+
+                std::fill(items_started.begin(), items_started.end(), false);
+                if(group_linear_id == probe.first) { items_started[probe.second % local_linear_range] = true; }
+
+                for(const auto next_local_linear_id : order) {
+                    // skip the probe, and items that were handed to fibers after a fallback
+                    if(items_started[next_local_linear_id]) continue;
+                    items_started[next_local_linear_id] = true;
+                    local_linear_id = next_local_linear_id;
+
+                    const auto nd_item = items.make_nd_item(
+                        group_linear_id, (concurrent_local_group_idx * local_linear_range) + local_linear_id);
+                    if(invoke_kernel(nd_item) && fallback_group_linear_id == group_linear_id) {
+                        perform_exit_operations(nd_item);
+                    }
+                    ++concurrent_group.instance.num_items_exited;
+                }
+
+                // wait for fallback fibers, if any
+                runner_awaits_group_exit = true;
+                while(!handed_over && concurrent_group.instance.num_items_exited < local_linear_range) {
+                    yield_to_kernel_scheduler();
+                }
+                runner_awaits_group_exit = false;
+                if(handed_over) {
+                    continue_with_next_groups(
+                        (concurrent_local_group_idx * local_linear_range) + local_linear_id, group_linear_id);
+                    return leave_kernel_fiber();
+                }
+                schedule_state = schedule.update(schedule_state, order);
+            }
+        }
+
+        return leave_kernel_fiber();
+    };
+
+    const auto make_fallback_fiber = [&](const size_t fallback_local_linear_id) {
+        return [&, fallback_group_linear_id = group_linear_id, fallback_concurrent_local_group_idx
+                   = concurrent_local_group_idx, fallback_local_linear_id](boost::context::continuation &&scheduler) {
+            enter_kernel_fiber(std::move(scheduler));
+            const auto concurrent_local_idx
+                = (fallback_concurrent_local_group_idx * local_linear_range) + fallback_local_linear_id;
+            const auto nd_item = items.make_nd_item(fallback_group_linear_id, concurrent_local_idx);
+            if(invoke_kernel(nd_item)) { perform_exit_operations(nd_item); }
+            ++items.concurrent_groups[fallback_concurrent_local_group_idx].instance.num_items_exited;
+            if(handed_over) { continue_with_next_groups(concurrent_local_idx, fallback_group_linear_id); }
+            return leave_kernel_fiber();
+        };
+    };
+
+    const auto fall_back_to_fibers = [&] {
+        fallback_group_linear_id = group_linear_id;
+
+        // all items started before the one suspended in the runner have exited without any group operation
+        std::vector<size_t> num_exited_in_sub_group(sub_group_linear_range_in_group);
+        std::vector<size_t> first_exited_in_sub_group(sub_group_linear_range_in_group);
+        size_t num_exited = 0;
+        size_t first_exited = 0;
+        for(size_t id = local_linear_range; id-- > 0;) {
+            if(!items_started[id] || id == local_linear_id) continue;
+            const auto sub_group_idx = id / sub_group_max_local_linear_range;
+            ++num_exited_in_sub_group[sub_group_idx];
+            first_exited_in_sub_group[sub_group_idx] = id % sub_group_max_local_linear_range;
+            ++num_exited;
+            first_exited = id;
+        }
+        register_exited_work_items(items.concurrent_groups[concurrent_local_group_idx].instance.operations,
+            local_linear_range, static_cast<int>(first_exited), num_exited);
+        for(size_t sub_group_idx = 0; sub_group_idx < sub_group_linear_range_in_group; ++sub_group_idx) {
+            const auto sub_group_local_linear_range = std::min(sub_group_max_local_linear_range,
+                local_linear_range - (sub_group_idx * sub_group_max_local_linear_range));
+            auto &concurrent_sub_group = items.concurrent_sub_groups[(concurrent_local_group_idx
+                                                                         * sub_group_linear_range_in_group)
+                + sub_group_idx];
+            register_exited_work_items(concurrent_sub_group.instance.operations, sub_group_local_linear_range,
+                static_cast<int>(first_exited_in_sub_group[sub_group_idx]), num_exited_in_sub_group[sub_group_idx]);
+        }
+
+        for(const auto id : order) {
+            if(items_started[id]) continue;
+            items_started[id] = true;
+            fallback_fibers[id] = boost::context::callcc(std::allocator_arg, stack_allocator, make_fallback_fiber(id));
+        }
+    };
+
+    bool runner_suspended = false;
+    boost::context::continuation runner_fiber;
+    const auto resume_runner = [&] {
+        const auto suspensions_before = g_num_kernel_suspensions;
+        runner_fiber = runner_fiber ? runner_fiber.resume()
+                                    : boost::context::callcc(std::allocator_arg, stack_allocator, runner);
+        runner_suspended = g_num_kernel_suspensions != suspensions_before;
+    };
+
+    // whether a suspended work item of the runner's group waits on something other than a group operation
+    const auto suspended_outside_group_operation = [&](const size_t id) {
+        return items.concurrent_nd_items[(concurrent_local_group_idx * local_linear_range) + id].blocking_operations
+            == nullptr;
+    };
+
+    // The runner and the fallback fibers continue with their next groups once the runner's group has exited, and every
+    // other concurrent work item receives a fiber starting with the first group the runner has not yet executed.
+    const auto hand_over_to_item_fibers = [&] {
+        handed_over = true;
+        if(fallback_group_linear_id != group_linear_id) { fall_back_to_fibers(); }
+
+        const auto first_group_in_wave = group_linear_id - concurrent_local_group_idx;
+        for(size_t other_local_group_idx = 0; other_local_group_idx < num_local_concurrent_groups;
+            ++other_local_group_idx) {
+            item_fibers.first_group_linear_ids[other_local_group_idx] = first_group_in_wave + other_local_group_idx
+                + (other_local_group_idx <= concurrent_local_group_idx ? launch.num_concurrent_groups : 0);
+        }
+
+        std::fill(item_fibers.created.begin(), item_fibers.created.end(), false);
+        for(size_t id = 0; id < local_linear_range; ++id) {
+            const auto concurrent_local_idx = (concurrent_local_group_idx * local_linear_range) + id;
+            auto &fiber = item_fibers.fibers[concurrent_local_idx];
+            if(id == local_linear_id) {
+                fiber = std::move(runner_fiber);
+            } else if(fallback_fibers[id]) {
+                fiber = std::move(fallback_fibers[id]);
+            } else {
+                // the item has exited, so its new fiber must not start the next group before all others have exited
+                item_fibers.awaited_group_exits[concurrent_local_idx] = group_linear_id;
+            }
+            item_fibers.created[concurrent_local_idx] = static_cast<bool>(fiber);
+        }
+
+        run_fibers();
+    };
+
+    // as in run_concurrent_groups, fibers waiting on other items are only resumed once they can make progress
+    const auto is_blocked = [&](const size_t id) {
+        const auto &item = items.concurrent_nd_items[(concurrent_local_group_idx * local_linear_range) + id];
+        if(is_blocked_on_group_operation(item)) return true;
+        return id == local_linear_id && runner_awaits_group_exit
+            && items.concurrent_groups[concurrent_local_group_idx].instance.num_items_exited < local_linear_range;
+    };
+    bool resume_blocked = false;
+
+    resume_runner();
+    while(runner_fiber) {
+        if(runner_suspended && !runner_awaits_group_exit && suspended_outside_group_operation(local_linear_id)) {
+            hand_over_to_item_fibers();
+            return;
+        }
+        if(runner_suspended && fallback_group_linear_id != group_linear_id) { fall_back_to_fibers(); }
+        if(fallback_group_linear_id == group_linear_id) {
+            bool any_resumed = false;
+            for(const auto id : order) {
+                // stop once the runner has advanced to the next group or completed
+                if(!runner_fiber || fallback_group_linear_id != group_linear_id) break;
+                if(!resume_blocked && is_blocked(id)) continue;
+                if(id == local_linear_id) {
+                    resume_runner();
+                    any_resumed = true;
+                } else if(fallback_fibers[id]) {
+                    fallback_fibers[id] = fallback_fibers[id].resume();
+                    any_resumed = true;
+                    if(fallback_fibers[id] && suspended_outside_group_operation(id)) {
+                        hand_over_to_item_fibers();
+                        return;
+                    }
+                }
+            }
+            if(!any_resumed) {
+                for(const auto id : order) {
+                    invalidate_blocking_group_operation(
+                        items.concurrent_nd_items[(concurrent_local_group_idx * local_linear_range) + id]);
+                }
+            }
+            resume_blocked = !any_resumed;
+        } else {
+            resume_runner();
+        }
+    }
+}
+
+// Executes all groups assigned to the concurrent groups of `items` as fibers on the calling thread. Concurrent groups
+// share no state, so disjoint subsets can be executed on different threads.
+//
+// Fibers are created lazily in schedule order. If the first work item completes without ever suspending on a group
+// operation, barrier or atomic, the kernel is assumed to be free of dependencies between work items and the remaining
+// work items are executed as plain function calls instead (see run_barrier_free).
+template<int Dimensions>
+void run_concurrent_groups(concurrent_work_items<Dimensions> &items, const nd_kernel<Dimensions> &kernel,
+    const cooperative_schedule &schedule, std::vector<std::exception_ptr> &caught_exceptions) //
+{
+    const auto &launch = items.launch;
+    const auto local_linear_range = launch.local_linear_range;
+    const auto group_linear_range = launch.group_linear_range;
+    const auto num_concurrent_groups = launch.num_concurrent_groups;
+    const auto first_concurrent_group = items.first_concurrent_group;
+    const auto num_concurrent_items = items.concurrent_nd_items.size();
+
+    local_memory_binding_scope binding_scope(
+        items.bind_local_memory_to_thread ? &items.local_memory_bindings : nullptr);
+
+    // Invokes the kernel and returns whether it completed without throwing.
+    const auto invoke_kernel = [&](const sycl::nd_item<Dimensions> &nd_item) {
+        reset_atomic_spin_detection();
+        try {
+            kernel(nd_item);
+            return true;
+        } catch(const boost::context::detail::forced_unwind &) {
+            throw; // fiber is being destroyed while suspended
+        } catch(...) { //
+            caught_exceptions.push_back(std::current_exception());
+            return false;
+        }
+    };
+    // Add an implicit "exit" operations to groups and sub-groups to catch potential divergence on the last group
+    // operation
+    const auto perform_exit_operations = [&](const sycl::nd_item<Dimensions> &nd_item) {
+        try {
+            perform_group_operation(
+                nd_item.get_group(), detail::group_operation_id::exit, detail::group_operation_spec{});
+            perform_group_operation(
+                nd_item.get_sub_group(), detail::group_operation_id::exit, detail::group_operation_spec{});
+        } catch(const boost::context::detail::forced_unwind &) {
+            throw; // fiber is being destroyed while suspended
+        } catch(...) { //
+            caught_exceptions.push_back(std::current_exception());
+        }
+    };
+
+    size_t concurrent_items_exited = 0;
+    bool probing = true;
+    std::optional<std::pair<size_t, size_t>> barrier_free_probe; // (group_linear_id, concurrent_local_idx)
+    concurrent_item_fibers item_fibers(num_concurrent_items, items.concurrent_groups.size(), first_concurrent_group);
+
+    // Wait for all items in the group before scheduling the next group on this fiber (otherwise we could get races
+    // between items of different groups accessing the same re-used local memory allocation).
+    const auto await_group_exit = [&](const size_t concurrent_local_idx, const size_t group_linear_id) {
+        const auto &instance = items.concurrent_groups[concurrent_local_idx / local_linear_range].instance;
+        // If group_linear_id changes, another fiber has advanced to the next group, if we observe that all items have
+        // exited, we are the fiber to proceed to the next iteration.
+        item_fibers.awaited_group_exits[concurrent_local_idx] = group_linear_id;
+        while(instance.group_linear_id == group_linear_id && instance.num_items_exited < local_linear_range) {
+            yield_to_kernel_scheduler();
+        }
+        item_fibers.awaited_group_exits[concurrent_local_idx].reset();
+    };
+
+    // Executes the work item `concurrent_local_idx` of `first_group_linear_id` and of all groups following it on the
+    // same concurrent group.
+    const auto run_groups = [&](const size_t concurrent_local_idx, const size_t first_group_linear_id) {
+        auto &concurrent_group = items.concurrent_groups[concurrent_local_idx / local_linear_range];
+        for(size_t group_linear_id = first_group_linear_id; group_linear_id < group_linear_range;
+            group_linear_id += num_concurrent_groups) //
+        {
+            const auto nd_item = items.make_nd_item(group_linear_id, concurrent_local_idx);
+            const bool completed = invoke_kernel(nd_item);
+            // the scheduler resets `probing` as soon as the first item suspends
+            if(std::exchange(probing, false)) {
+                barrier_free_probe.emplace(group_linear_id, concurrent_local_idx);
+                ++concurrent_group.instance.num_items_exited;
+                return;
+            }
+            if(completed) { perform_exit_operations(nd_item); }
+            // the kernel might have thrown while suspended on a group operation
+            items.concurrent_nd_items[concurrent_local_idx].blocking_operations = nullptr;
+            ++concurrent_group.instance.num_items_exited;
+            await_group_exit(concurrent_local_idx, group_linear_id);
+        }
+        ++concurrent_items_exited;
+    };
+
+    // Continues a fiber handed over from run_barrier_free after its work item of `group_linear_id` has exited.
+    const auto continue_with_next_groups = [&](const size_t concurrent_local_idx, const size_t group_linear_id) {
+        items.concurrent_nd_items[concurrent_local_idx].blocking_operations = nullptr;
+        await_group_exit(concurrent_local_idx, group_linear_id);
+        run_groups(concurrent_local_idx, group_linear_id + num_concurrent_groups);
+    };
+
+    const auto make_fiber = [&](const size_t concurrent_local_idx) {
+        return [&, concurrent_local_idx](boost::context::continuation &&scheduler) {
+            enter_kernel_fiber(std::move(scheduler));
+            // after a hand-over from run_barrier_free, items might first have to wait for a group to exit
+            if(const auto awaited_group_exit = item_fibers.awaited_group_exits[concurrent_local_idx]) {
+                await_group_exit(concurrent_local_idx, *awaited_group_exit);
+            }
+            run_groups(
+                concurrent_local_idx, item_fibers.first_group_linear_ids[concurrent_local_idx / local_linear_range]);
+            return leave_kernel_fiber();
+        };
+    };
+
+    auto &fibers = item_fibers.fibers;
+    auto &fibers_created = item_fibers.created;
+    const auto stack_allocator = pooled_fixedsize_stack(launch.fiber_stack_size, launch.fiber_stack_usage);
+
+    // Fibers waiting on a group operation or on the other items of their group to exit are not resumed until the
+    // condition is met, which would otherwise cost a context switch per waiting item and scheduling round.
+    const auto is_blocked = [&](const size_t concurrent_local_idx) {
+        if(is_blocked_on_group_operation(items.concurrent_nd_items[concurrent_local_idx])) return true;
+        const auto &awaited_group_exit = item_fibers.awaited_group_exits[concurrent_local_idx];
+        if(!awaited_group_exit.has_value()) return false;
+        const auto &instance = items.concurrent_groups[concurrent_local_idx / local_linear_range].instance;
+        return instance.group_linear_id == *awaited_group_exit && instance.num_items_exited < local_linear_range;
+    };
+    // if all remaining fibers are blocked, the kernel has diverged, and we resume them regardless to have it reported
+    // through the operations they are blocked on
+    bool resume_blocked = false;
+
+    // In group-major order, the schedule only orders the items of a single group, and concurrent groups are resumed
+    // one after the other.
+    const bool group_major = launch.group_major_resume_order;
+    std::vector<size_t> order(group_major ? local_linear_range : num_concurrent_items);
+    auto schedule_state = schedule.init(order);
+
+    // Runs until all are complete (this does an extra loop), or until the first item has completed without suspending.
+    const auto run_fibers = [&] {
+        while(concurrent_items_exited < num_concurrent_items) {
+            bool any_resumed = false;
+            for(size_t i = 0; i < num_concurrent_items; ++i) {
+                const size_t concurrent_local_idx = group_major
+                    ? (i / local_linear_range * local_linear_range) + order[i % local_linear_range]
+                    : order[i];
+
+                if(fibers_created[concurrent_local_idx] && !fibers[concurrent_local_idx]) continue; // already exited
+                if(fibers_created[concurrent_local_idx] && !resume_blocked && is_blocked(concurrent_local_idx)) {
+                    continue;
+                }
+                any_resumed = true;
+
+                // adjust local memory pointers if switching to a fiber of another group
+                items.select_local_memory(concurrent_local_idx / local_linear_range);
+
+                if(!fibers_created[concurrent_local_idx]) {
+                    fibers[concurrent_local_idx] = boost::context::callcc(
+                        std::allocator_arg, stack_allocator, make_fiber(concurrent_local_idx));
+                    fibers_created[concurrent_local_idx] = true;
+                } else {
+                    fibers[concurrent_local_idx] = fibers[concurrent_local_idx].resume();
+                }
+
+                probing = false;
+                if(barrier_free_probe.has_value()) return;
+            }
+            if(!any_resumed) {
+                for(const auto &item : items.concurrent_nd_items) { invalidate_blocking_group_operation(item); }
+            }
+            resume_blocked = !any_resumed;
+            schedule_state = schedule.update(schedule_state, order);
+        }
+    };
+
+    run_fibers();
+    if(barrier_free_probe.has_value()) {
+        const auto probe = *std::exchange(barrier_free_probe, std::nullopt);
+        run_barrier_free(items, invoke_kernel, perform_exit_operations, continue_with_next_groups, item_fibers,
+            run_fibers, schedule, stack_allocator, probe);
+    }
+}
+
+template<int Dimensions>
+void check_nd_range_requirements(
+    const sycl::device &device, const std::vector<local_memory_requirement> &local_memory) //
 {
     if(Dimensions > device.get_info<sycl::info::device::max_work_item_dimensions>()) {
         throw sycl::exception(sycl::errc::nd_range, "Work item dimensionality exceeds device limit");
@@ -144,10 +1036,23 @@ void cooperative_for_nd_range(const sycl::device &device, const sycl::nd_range<D
     if(required_local_memory > device.get_info<sycl::info::device::local_mem_size>()) {
         throw sycl::exception(sycl::errc::accessor, "Total required local memory exceeds device limit");
     }
+}
+
+// Validated geometry of an ND-range launch together with the per-thread group and work item state to execute it.
+template<int Dimensions>
+struct nd_range_plan {
+    nd_range_launch<Dimensions> launch;
+    size_t num_workers;
+    std::vector<std::unique_ptr<concurrent_work_items<Dimensions>>> worker_items; // created lazily by each worker
+};
+
+template<int Dimensions>
+std::unique_ptr<nd_range_plan<Dimensions>> make_nd_range_plan(const sycl::device &device,
+    const sycl::nd_range<Dimensions> &range, const std::vector<local_memory_requirement> &local_memory,
+    const std::optional<size_t> fiber_budget, const size_t num_worker_threads) //
+{
+    check_nd_range_requirements<Dimensions>(device, local_memory);
 
-    const auto &global_range = range.get_global_range();
-    const auto global_linear_range = global_range.size();
-    if(global_linear_range == 0) return;
     const auto &group_range = range.get_group_range();
     const auto group_linear_range = group_range.size();
     assert(group_linear_range > 0);
@@ -172,160 +1077,142 @@ void cooperative_for_nd_range(const sycl::device &device, const sycl::nd_range<D
     }
 
     // limit the number of concurrent groups to avoid allocating excessive numbers of fibers
-    const size_t max_num_concurrent_groups = device.get_info<sycl::info::device::max_compute_units>();
-    const auto num_concurrent_groups = std::min(group_linear_range, max_num_concurrent_groups);
-    const auto num_concurrent_sub_groups = num_concurrent_groups * sub_group_linear_range_in_group;
-    const auto num_concurrent_items = num_concurrent_groups * local_linear_range;
-
-    std::vector<detail::concurrent_group> concurrent_groups(num_concurrent_groups);
-    std::vector<detail::concurrent_sub_group> concurrent_sub_groups(num_concurrent_sub_groups);
-    std::vector<detail::concurrent_nd_item> num_concurrent_nd_items(num_concurrent_items);
-
-    for(auto &cgroup : concurrent_groups) {
-        cgroup.local_memory_allocations.resize(local_memory.size());
-        for(size_t i = 0; i < local_memory.size(); ++i) {
-            cgroup.local_memory_allocations[i] = allocation(local_memory[i].size, local_memory[i].align);
-        }
-    }
-
-    size_t concurrent_items_exited = 0;
-    std::vector<std::exception_ptr> caught_exceptions;
-    std::vector<boost::context::continuation> fibers;
-
-    // build the item / group structures and fibers for all concurrent work items
-    for(size_t concurrent_global_idx = 0; concurrent_global_idx < num_concurrent_items; ++concurrent_global_idx) {
-        // all these ids and linear ids are persistent between all groups this fiber iterates over
-        const auto local_linear_id = concurrent_global_idx % local_linear_range;
-        const auto local_id = linear_index_to_id(local_range, local_linear_id);
-        const auto sub_group_linear_id_in_group = local_linear_id / sub_group_max_local_linear_range;
-        const auto thread_linear_id_in_sub_group = local_linear_id % sub_group_max_local_linear_range;
-        const auto sub_group_id_in_group = sycl::id<1>(sub_group_linear_id_in_group);
-        const auto thread_id_in_sub_group = sycl::id<1>(thread_linear_id_in_sub_group);
+    const size_t max_num_concurrent_groups = fiber_budget.has_value()
+        ? *fiber_budget / local_linear_range
+        : std::min<size_t>(device.get_info<sycl::info::device::max_compute_units>(),
+            default_max_concurrent_work_items / local_linear_range);
+    const auto num_concurrent_groups = std::clamp<size_t>(max_num_concurrent_groups, 1, group_linear_range);
+
+    // Concurrent groups are independent of each other, so we can distribute them across worker threads which each run
+    // their own set of fibers. Group operations are only ever performed between fibers of the same concurrent group.
+    const auto num_workers = std::min(num_worker_threads, num_concurrent_groups);
+
+    return std::make_unique<nd_range_plan<Dimensions>>(nd_range_plan<Dimensions>{
+        .launch{
+            .range = range,
+            .local_range = local_range,
+            .local_linear_range = local_linear_range,
+            .group_range = group_range,
+            .group_linear_range = group_linear_range,
+            .sub_group_max_local_linear_range = sub_group_max_local_linear_range,
+            .sub_group_max_local_range = sub_group_max_local_range,
+            .sub_group_linear_range_in_group = sub_group_linear_range_in_group,
+            .sub_group_range_in_group = sub_group_range_in_group,
+            .num_concurrent_groups = num_concurrent_groups,
+            .group_major_resume_order = false,
+            .fiber_stack_size = default_fiber_stack_size,
+            .fiber_stack_usage = nullptr,
+        },
+        .num_workers = num_workers,
+        .worker_items = std::vector<std::unique_ptr<concurrent_work_items<Dimensions>>>(num_workers),
+    });
+}
 
-        const auto concurrent_group_idx = concurrent_global_idx / local_linear_range;
-        const auto concurrent_sub_group_idx
-            = (concurrent_group_idx * sub_group_linear_range_in_group) + sub_group_linear_id_in_group;
+// Applications tend to launch the same kernel shapes over and over, so we keep the plans of the most recent launches
+// around on each thread. This skips device validation and the allocation of group state, local memory and work item
+// tables, leaving only the fibers to be re-created.
+template<int Dimensions>
+class nd_range_plan_cache {
+  public:
+    nd_range_plan<Dimensions> &get(const sycl::device &device, const sycl::nd_range<Dimensions> &range,
+        const std::vector<local_memory_requirement> &local_memory, const std::optional<size_t> fiber_budget,
+        const size_t num_worker_threads) //
+    {
+        const auto same_layout = [](const std::pair<size_t, size_t> &layout, const local_memory_requirement &req) {
+            return layout.first == req.size && layout.second == req.align;
+        };
+        const auto hit = std::find_if(m_entries.begin(), m_entries.end(), [&](const entry &e) {
+            return e.device == device && e.range == range && e.fiber_budget == fiber_budget
+                && e.num_worker_threads == num_worker_threads
+                && std::equal(e.local_memory_layout.begin(), e.local_memory_layout.end(), local_memory.begin(),
+                    local_memory.end(), same_layout);
+        });
+        if(hit != m_entries.end()) {
+            // move to the back, which holds the most recently used plan
+            std::rotate(hit, std::next(hit), m_entries.end());
+            return *m_entries.back().plan;
+        }
 
-        auto &concurrent_nd_item = num_concurrent_nd_items[concurrent_global_idx];
+        // throws without modifying the cache if the launch is invalid
+        auto plan = make_nd_range_plan(device, range, local_memory, fiber_budget, num_worker_threads);
+        if(m_entries.size() == max_entries) { m_entries.erase(m_entries.begin()); }
+        std::vector<std::pair<size_t, size_t>> local_memory_layout;
+        for(const auto &req : local_memory) { local_memory_layout.emplace_back(req.size, req.align); }
+        return *m_entries
+                    .emplace_back(entry{device, range, std::move(local_memory_layout), fiber_budget,
+                        num_worker_threads, std::move(plan)})
+                    .plan;
+    }
 
-        auto &concurrent_group = concurrent_groups[concurrent_group_idx];
-        concurrent_group.concurrent_nd_items.push_back(&concurrent_nd_item);
-        concurrent_nd_item.concurrent_group = &concurrent_group;
+  private:
+    constexpr static size_t max_entries = 8;
 
-        auto &concurrent_sub_group = concurrent_sub_groups[concurrent_sub_group_idx];
-        concurrent_sub_group.concurrent_nd_items.push_back(&concurrent_nd_item);
-
-        fibers.push_back(boost::context::callcc(
-            [concurrent_group_idx, num_concurrent_groups, local_id, local_range, local_linear_range, group_range,
-                group_linear_range, sub_group_linear_id_in_group, sub_group_linear_range_in_group,
-                sub_group_max_local_linear_range, sub_group_max_local_range, thread_id_in_sub_group,
-                sub_group_id_in_group, sub_group_range_in_group, &concurrent_nd_item, &concurrent_group,
-                &concurrent_sub_group, &kernel, &concurrent_items_exited, &caught_exceptions,
-                &range](boost::context::continuation &&scheduler) //
-            {
-                // yield immediately to allow the scheduling loop to set up local memory pointers
-                enter_kernel_fiber(std::move(scheduler));
-                yield_to_kernel_scheduler();
-
-                for(size_t group_linear_id = concurrent_group_idx; group_linear_id < group_linear_range;
-                    group_linear_id += num_concurrent_groups) //
-                {
-                    const auto sub_group_linear_id
-                        = (group_linear_id * sub_group_linear_range_in_group) + sub_group_linear_id_in_group;
-
-                    concurrent_nd_item.instance = nd_item_instance{};
-                    // the first item to arrive in this group will create the new group instance
-                    if(concurrent_group.instance.group_linear_id != group_linear_id) {
-                        concurrent_group.instance = group_instance(group_linear_id);
-                    }
-                    // the first item to arrive in this sub_group will create the new sub_group instance
-                    if(concurrent_sub_group.instance.sub_group_linear_id != sub_group_linear_id) {
-                        concurrent_sub_group.instance = sub_group_instance(sub_group_linear_id);
-                    }
+    struct entry {
+        sycl::device device;
+        sycl::nd_range<Dimensions> range;
+        std::vector<std::pair<size_t, size_t>> local_memory_layout; // (size, align) for each local memory slot
+        std::optional<size_t> fiber_budget;
+        size_t num_worker_threads;
+        std::unique_ptr<nd_range_plan<Dimensions>> plan;
+    };
 
-                    SIMSYCL_START_IGNORING_DEPRECATIONS;
-                    const auto group_id = linear_index_to_id(group_range, group_linear_id);
-                    const auto global_id = range.get_offset() + (group_id * sycl::id<Dimensions>(local_range)) + local_id;
-
-                    // if sub-group range is not divisible by local range, the last sub-group will be smaller
-                    const auto sub_group_local_linear_range = std::min(sub_group_max_local_linear_range,
-                        local_linear_range - (sub_group_linear_id_in_group * sub_group_max_local_linear_range));
-                    const auto sub_group_local_range = sycl::range<1>(sub_group_local_linear_range);
-
-                    const auto global_item = detail::make_item(global_id, range.get_global_range(), range.get_offset());
-                    SIMSYCL_STOP_IGNORING_DEPRECATIONS;
-                    const auto local_item = detail::make_item(local_id, range.get_local_range());
-                    const auto group_item = detail::make_item(group_id, range.get_group_range());
-
-                    const auto group = detail::make_group(
-                        group_type::nd_range, local_item, global_item, group_item, &concurrent_group);
-                    const auto sub_group = detail::make_sub_group(thread_id_in_sub_group, sub_group_local_range,
-                        sub_group_max_local_range, sub_group_id_in_group, sub_group_range_in_group,
-                        &concurrent_sub_group);
-                    const auto nd_item
-                        = detail::make_nd_item(global_item, local_item, group, sub_group, &concurrent_nd_item);
-
-                    try {
-                        kernel(nd_item);
-                        // Add an implicit "exit" operations to groups and sub-groups to catch potential divergence on
-                        // the last group operation
-                        perform_group_operation(
-                            nd_item.get_group(), detail::group_operation_id::exit, detail::group_operation_spec{});
-                        perform_group_operation(
-                            nd_item.get_sub_group(), detail::group_operation_id::exit, detail::group_operation_spec{});
-                    } catch(...) { //
-                        caught_exceptions.push_back(std::current_exception());
-                    }
+    std::vector<entry> m_entries; // least recently used first
+};
 
-                    // Wait for all items in the group before scheduling the next group on this fiber (otherwise we
-                    // could get races between items of different groups accessing the same re-used local memory
-                    // allocation).
-                    ++concurrent_group.instance.num_items_exited;
-                    // If group_linear_id changes, another fiber has advanced to the next group, if we observe that all
-                    // items have exited, we are the fiber to proceed to the next iteration.
-                    while(concurrent_group.instance.group_linear_id == group_linear_id
-                        && concurrent_group.instance.num_items_exited < local_linear_range) {
-                        yield_to_kernel_scheduler();
-                    }
-                }
+template<int Dimensions>
+thread_local nd_range_plan_cache<Dimensions> g_nd_range_plan_cache;
 
-                ++concurrent_items_exited;
-                return leave_kernel_fiber();
-            }));
+template<int Dimensions>
+void cooperative_for_nd_range(const sycl::device &device, const sycl::nd_range<Dimensions> &range,
+    const std::vector<local_memory_requirement> &local_memory, const nd_kernel<Dimensions> &kernel,
+    const size_t num_worker_threads, const std::type_info &kernel_name_type, const std::type_info &kernel_func_type) //
+{
+    if(range.get_global_range().size() == 0) {
+        check_nd_range_requirements<Dimensions>(device, local_memory);
+        return;
     }
 
+    auto &plan
+        = g_nd_range_plan_cache<Dimensions>.get(device, range, local_memory, get_fiber_budget(), num_worker_threads);
+    auto &launch = plan.launch;
+    launch.group_major_resume_order = get_group_major_resume_order();
+    launch.fiber_stack_size = get_fiber_stack_size();
+    launch.fiber_stack_usage = get_fiber_stack_usage_tracking()
+        ? &fiber_stack_usage_registry::get().get_record(
+            get_kernel_diagnostic_name(kernel_name_type, kernel_func_type), get_fiber_stack_size())
+        : nullptr;
+
+    const auto num_workers = plan.num_workers;
+    const auto num_concurrent_groups = launch.num_concurrent_groups;
     const auto &schedule = get_cooperative_schedule();
-    std::vector<size_t> order(num_concurrent_items);
-    auto schedule_state = schedule.init(order);
-
-    // run until all are complete (this does an extra loop)
-    while(concurrent_items_exited < num_concurrent_items) {
-        for(size_t i = 0; i < num_concurrent_items; ++i) {
-            const size_t concurrent_global_idx = order[i];
-
-            if(!fibers[concurrent_global_idx]) continue; // already exited
-
-            // adjust local memory pointers before switching fibers
-            const auto concurrent_group_idx = concurrent_global_idx / local_linear_range;
-            for(size_t i = 0; i < local_memory.size(); ++i) {
-                *local_memory[i].ptr = concurrent_groups[concurrent_group_idx].local_memory_allocations[i].get();
-            }
-
-            fibers[concurrent_global_idx] = fibers[concurrent_global_idx].resume();
+    std::vector<std::vector<std::exception_ptr>> caught_exceptions(num_workers);
+    run_on_worker_threads(num_workers, [&](const size_t worker_index) {
+        auto &items = plan.worker_items[worker_index];
+        if(items == nullptr) {
+            const auto first_group = worker_index * num_concurrent_groups / num_workers;
+            const auto last_group = (worker_index + 1) * num_concurrent_groups / num_workers;
+            items = std::make_unique<concurrent_work_items<Dimensions>>(
+                launch, local_memory, first_group, last_group - first_group, num_workers > 1);
         }
-        schedule_state = schedule.update(schedule_state, order);
-    }
+        items->begin_launch(local_memory);
+        run_concurrent_groups(*items, kernel, schedule, caught_exceptions[worker_index]);
+    });
 
     // rethrow any encountered exceptions
-    for(auto &exception : caught_exceptions) { std::rethrow_exception(exception); }
+    for(auto &worker_exceptions : caught_exceptions) {
+        for(auto &exception : worker_exceptions) { std::rethrow_exception(exception); }
+    }
 }
 
 template void cooperative_for_nd_range<1>(const sycl::device &device, const sycl::nd_range<1> &range,
-    const std::vector<local_memory_requirement> &local_memory, const nd_kernel<1> &kernel);
+    const std::vector<local_memory_requirement> &local_memory, const nd_kernel<1> &kernel, size_t num_worker_threads,
+    const std::type_info &kernel_name_type, const std::type_info &kernel_func_type);
 template void cooperative_for_nd_range<2>(const sycl::device &device, const sycl::nd_range<2> &range,
-    const std::vector<local_memory_requirement> &local_memory, const nd_kernel<2> &kernel);
+    const std::vector<local_memory_requirement> &local_memory, const nd_kernel<2> &kernel, size_t num_worker_threads,
+    const std::type_info &kernel_name_type, const std::type_info &kernel_func_type);
 template void cooperative_for_nd_range<3>(const sycl::device &device, const sycl::nd_range<3> &range,
-    const std::vector<local_memory_requirement> &local_memory, const nd_kernel<3> &kernel);
+    const std::vector<local_memory_requirement> &local_memory, const nd_kernel<3> &kernel, size_t num_worker_threads,
+    const std::type_info &kernel_name_type, const std::type_info &kernel_func_type);
 
 template<int Dimensions>
 std::vector<allocation> prepare_hierarchical_parallel_for(const sycl::device &device,
@@ -355,7 +1242,8 @@ std::vector<allocation> prepare_hierarchical_parallel_for(const sycl::device &de
 
     std::vector<allocation> local_allocations;
     for(size_t i = 0; i < local_memory.size(); ++i) {
-        *local_memory[i].ptr = local_allocations.emplace_back(local_memory[i].size, local_memory[i].align).get();
+        local_memory[i].slot->allocation
+            = local_allocations.emplace_back(local_memory[i].size, local_memory[i].align).get();
     }
     return local_allocations;
 }
@@ -369,6 +1257,55 @@ template std::vector<allocation> prepare_hierarchical_parallel_for<3>(const sycl
 
 
 thread_local std::shared_ptr<const cooperative_schedule> g_cooperative_schedule;
+thread_local std::optional<size_t> g_num_worker_threads;
+thread_local std::optional<bool> g_group_major_resume_order;
+thread_local std::optional<bool> g_deterministic_reductions;
+thread_local std::optional<std::optional<size_t>> g_fiber_budget;
+thread_local std::optional<joint_algorithm_verification> g_joint_algorithm_verification;
+thread_local std::optional<atomic_yield_policy> g_atomic_yield_policy;
+thread_local size_t g_atomic_yield_threshold = default_atomic_yield_threshold;
+thread_local std::optional<size_t> g_fiber_stack_size;
+thread_local std::optional<bool> g_fiber_stack_usage_tracking;
+thread_local std::optional<bool> g_async_queue_submission;
+
+extern thread_local int g_check_mode_override;
+
+kernel_settings get_kernel_settings() {
+    get_cooperative_schedule(); // initialize from the environment if necessary
+    return {
+        .schedule = g_cooperative_schedule,
+        .num_worker_threads = get_num_worker_threads(),
+        .group_major_resume_order = get_group_major_resume_order(),
+        .deterministic_reductions = get_deterministic_reductions(),
+        .fiber_budget = get_fiber_budget(),
+        .joint_verification = get_joint_algorithm_verification(),
+        .atomic_yield = get_atomic_yield_policy(),
+        .atomic_yield_threshold = get_atomic_yield_threshold(),
+        .fiber_stack_size = get_fiber_stack_size(),
+        .fiber_stack_usage_tracking = get_fiber_stack_usage_tracking(),
+        .check_mode_override = g_check_mode_override,
+    };
+}
+
+void set_kernel_settings(const kernel_settings &settings) {
+    g_cooperative_schedule = settings.schedule;
+    g_num_worker_threads = settings.num_worker_threads;
+    g_group_major_resume_order = settings.group_major_resume_order;
+    g_deterministic_reductions = settings.deterministic_reductions;
+    g_fiber_budget = settings.fiber_budget;
+    g_joint_algorithm_verification = settings.joint_verification;
+    g_atomic_yield_policy = settings.atomic_yield;
+    g_atomic_yield_threshold = settings.atomic_yield_threshold;
+    g_fiber_stack_size = settings.fiber_stack_size;
+    g_fiber_stack_usage_tracking = settings.fiber_stack_usage_tracking;
+    g_check_mode_override = settings.check_mode_override;
+}
+
+void construct_kernel_launch_singletons() {
+    fiber_stack_usage_registry::get();
+    fiber_stack_pool::get();
+    construct_worker_pool();
+}
 
 } // namespace simsycl::detail
 
@@ -386,4 +1323,108 @@ void set_cooperative_schedule(std::shared_ptr<const cooperative_schedule> schedu
     detail::g_cooperative_schedule = std::move(schedule);
 }
 
+size_t get_num_worker_threads() {
+    if(!detail::g_num_worker_threads.has_value()) {
+        detail::g_num_worker_threads = get_default_num_worker_threads();
+    }
+    return *detail::g_num_worker_threads;
+}
+
+void set_num_worker_threads(const size_t num_threads) {
+    SIMSYCL_CHECK(num_threads > 0);
+    detail::g_num_worker_threads = num_threads;
+}
+
+bool get_deterministic_reductions() {
+    if(!detail::g_deterministic_reductions.has_value()) {
+        detail::g_deterministic_reductions = get_default_deterministic_reductions();
+    }
+    return *detail::g_deterministic_reductions;
+}
+
+void set_deterministic_reductions(const bool enable) { detail::g_deterministic_reductions = enable; }
+
+bool get_group_major_resume_order() {
+    if(!detail::g_group_major_resume_order.has_value()) {
+        detail::g_group_major_resume_order = get_default_group_major_resume_order();
+    }
+    return *detail::g_group_major_resume_order;
+}
+
+void set_group_major_resume_order(const bool enable) { detail::g_group_major_resume_order = enable; }
+
+std::optional<size_t> get_fiber_budget() {
+    if(!detail::g_fiber_budget.has_value()) { detail::g_fiber_budget = get_default_fiber_budget(); }
+    return *detail::g_fiber_budget;
+}
+
+void set_fiber_budget(const std::optional<size_t> max_concurrent_work_items) {
+    SIMSYCL_CHECK(max_concurrent_work_items.value_or(1) > 0);
+    detail::g_fiber_budget = max_concurrent_work_items;
+}
+
+joint_algorithm_verification get_joint_algorithm_verification() {
+    if(!detail::g_joint_algorithm_verification.has_value()) {
+        detail::g_joint_algorithm_verification = get_default_joint_algorithm_verification();
+    }
+    return *detail::g_joint_algorithm_verification;
+}
+
+void set_joint_algorithm_verification(const joint_algorithm_verification verification) {
+    detail::g_joint_algorithm_verification = verification;
+}
+
+atomic_yield_policy get_atomic_yield_policy() {
+    if(!detail::g_atomic_yield_policy.has_value()) {
+        detail::g_atomic_yield_policy = get_default_atomic_yield_policy();
+        detail::g_atomic_yield_threshold = get_default_atomic_yield_threshold();
+    }
+    return *detail::g_atomic_yield_policy;
+}
+
+size_t get_atomic_yield_threshold() {
+    get_atomic_yield_policy(); // initializes the threshold from the environment
+    return detail::g_atomic_yield_threshold;
+}
+
+void set_atomic_yield_policy(const atomic_yield_policy policy, const size_t threshold) {
+    SIMSYCL_CHECK(threshold > 0);
+    detail::g_atomic_yield_policy = policy;
+    detail::g_atomic_yield_threshold = threshold;
+}
+
+size_t get_fiber_stack_size() {
+    if(!detail::g_fiber_stack_size.has_value()) { detail::g_fiber_stack_size = get_default_fiber_stack_size(); }
+    return *detail::g_fiber_stack_size;
+}
+
+void set_fiber_stack_size(const size_t size_bytes) {
+    SIMSYCL_CHECK(size_bytes >= min_fiber_stack_size);
+    detail::g_fiber_stack_size = size_bytes;
+}
+
+bool get_fiber_stack_usage_tracking() {
+    if(!detail::g_fiber_stack_usage_tracking.has_value()) {
+        detail::g_fiber_stack_usage_tracking = get_default_fiber_stack_usage_tracking();
+    }
+    return *detail::g_fiber_stack_usage_tracking;
+}
+
+void set_fiber_stack_usage_tracking(const bool enable) { detail::g_fiber_stack_usage_tracking = enable; }
+
+bool get_async_queue_submission() {
+    if(!detail::g_async_queue_submission.has_value()) {
+        detail::g_async_queue_submission = get_default_async_queue_submission();
+    }
+    return *detail::g_async_queue_submission;
+}
+
+void set_async_queue_submission(const bool enable) { detail::g_async_queue_submission = enable; }
+
+std::vector<fiber_stack_usage> get_fiber_stack_usage() { return detail::fiber_stack_usage_registry::get().get_usage(); }
+
+fiber_stack_pool_statistics get_fiber_stack_pool_statistics() {
+    return detail::fiber_stack_pool::get().get_statistics();
+}
+
 } // namespace simsycl
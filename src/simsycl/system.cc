@@ -13,7 +13,9 @@
 #include <iostream>
 #include <limits>
 #include <set>
+#include <thread>
 #include <unordered_map>
+#include <utility>
 
 #include <libenvpp/env.hpp>
 
@@ -273,6 +275,15 @@ struct environment {
     std::optional<simsycl::system_config> system_config;
     // must be copyable to be returned from libenvpp parser
     std::shared_ptr<const simsycl::cooperative_schedule> cooperative_schedule;
+    std::optional<size_t> num_worker_threads;
+    std::optional<bool> group_major;
+    std::optional<bool> deterministic_reductions;
+    std::optional<size_t> fiber_budget;
+    std::optional<joint_algorithm_verification> joint_verification;
+    std::optional<std::pair<atomic_yield_policy, size_t>> atomic_yield;
+    std::optional<size_t> fiber_stack_size;
+    std::optional<bool> fiber_stack_report;
+    std::optional<bool> async;
 };
 
 shared_value<std::optional<environment>> g_parsed_environment;
@@ -292,14 +303,127 @@ const environment &parse_environment(system_lock &lock) {
                 const auto seed_repr = repr.substr(strlen("shuffle:"));
                 return std::make_unique<shuffle_schedule>(env::default_parser<uint64_t>{}(seed_repr));
             }
+            if(repr == "permute") return std::make_unique<permutation_schedule>();
+            if(repr.starts_with("permute:")) {
+                const auto seed_repr = repr.substr(strlen("permute:"));
+                return std::make_unique<permutation_schedule>(env::default_parser<uint64_t>{}(seed_repr));
+            }
+            if(repr == "morton") return std::make_unique<morton_schedule>();
+            if(repr == "tiled") return std::make_unique<tiled_schedule>();
+            if(repr.starts_with("tiled:")) {
+                const auto tile_size_repr = repr.substr(strlen("tiled:"));
+                const auto tile_size = env::default_parser<size_t>{}(tile_size_repr);
+                if(tile_size == 0) {
+                    throw env::parser_error{fmt::format("Invalid tile size '{}', must be positive", tile_size_repr)};
+                }
+                return std::make_unique<tiled_schedule>(tile_size);
+            }
+            throw env::parser_error{fmt::format("Invalid schedule '{}', permitted values are 'rr', 'shuffle', "
+                                                "'shuffle:<seed>', 'permute', 'permute:<seed>', 'morton', 'tiled', "
+                                                "and 'tiled:<tile size>'",
+                repr)};
+        });
+    const auto threads = prefix.register_variable<size_t>("THREADS", [](const std::string_view repr) -> size_t {
+        if(repr == "auto") return std::max(1u, std::thread::hardware_concurrency());
+        const auto num_threads = env::default_parser<size_t>{}(repr);
+        if(num_threads == 0) {
+            throw env::parser_error{fmt::format("Invalid thread count '{}', must be positive or 'auto'", repr)};
+        }
+        return num_threads;
+    });
+    const auto group_major = prefix.register_variable<bool>("GROUP_MAJOR", [](const std::string_view repr) -> bool {
+        if(repr == "0") return false;
+        if(repr == "1") return true;
+        throw env::parser_error{fmt::format("Invalid value '{}', permitted values are '0' and '1'", repr)};
+    });
+    const auto deterministic_reductions
+        = prefix.register_variable<bool>("DETERMINISTIC_REDUCTIONS", [](const std::string_view repr) -> bool {
+              if(repr == "0") return false;
+              if(repr == "1") return true;
+              throw env::parser_error{fmt::format("Invalid value '{}', permitted values are '0' and '1'", repr)};
+          });
+    const auto fiber_budget
+        = prefix.register_variable<size_t>("FIBER_BUDGET", [](const std::string_view repr) -> size_t {
+              const auto budget = env::default_parser<size_t>{}(repr);
+              if(budget == 0) {
+                  throw env::parser_error{fmt::format("Invalid fiber budget '{}', must be positive", repr)};
+              }
+              return budget;
+          });
+    const auto joint_verification = prefix.register_variable<joint_algorithm_verification>(
+        "JOINT_VERIFICATION", [](const std::string_view repr) -> joint_algorithm_verification {
+            if(repr == "all") return joint_algorithm_verification::all_work_items;
+            if(repr == "sampled") return joint_algorithm_verification::sampled;
+            if(repr == "none") return joint_algorithm_verification::none;
             throw env::parser_error{
-                fmt::format("Invalid schedule '{}', permitted values are 'rr', 'shuffle', and 'shuffle:<seed>'", repr)};
+                fmt::format("Invalid value '{}', permitted values are 'all', 'sampled', and 'none'", repr)};
+        });
+    const auto atomic_yield = prefix.register_variable<std::pair<atomic_yield_policy, size_t>>(
+        "ATOMIC_YIELD", [](const std::string_view repr) -> std::pair<atomic_yield_policy, size_t> {
+            const auto parse_threshold = [](const std::string_view threshold_repr) {
+                const auto threshold = env::default_parser<size_t>{}(threshold_repr);
+                if(threshold == 0) {
+                    throw env::parser_error{fmt::format("Invalid threshold '{}', must be positive", threshold_repr)};
+                }
+                return threshold;
+            };
+            if(repr == "always") return {atomic_yield_policy::always, default_atomic_yield_threshold};
+            if(repr == "never") return {atomic_yield_policy::never, default_atomic_yield_threshold};
+            if(repr == "spin") return {atomic_yield_policy::on_spin, default_atomic_yield_threshold};
+            if(repr.starts_with("spin:")) {
+                return {atomic_yield_policy::on_spin, parse_threshold(repr.substr(strlen("spin:")))};
+            }
+            if(repr.starts_with("every:")) {
+                return {atomic_yield_policy::interval, parse_threshold(repr.substr(strlen("every:")))};
+            }
+            throw env::parser_error{fmt::format("Invalid atomic yield policy '{}', permitted values are 'always', "
+                                                "'never', 'spin', 'spin:<n>', and 'every:<n>'",
+                repr)};
         });
+    const auto fiber_stack_size
+        = prefix.register_variable<size_t>("FIBER_STACK_SIZE", [](const std::string_view repr) -> size_t {
+              size_t unit = 1;
+              auto number_repr = repr;
+              if(repr.ends_with('k') || repr.ends_with('K')) {
+                  unit = size_t{1} << 10;
+                  number_repr.remove_suffix(1);
+              } else if(repr.ends_with('m') || repr.ends_with('M')) {
+                  unit = size_t{1} << 20;
+                  number_repr.remove_suffix(1);
+              }
+              const auto size = env::default_parser<size_t>{}(number_repr) * unit;
+              if(size < min_fiber_stack_size) {
+                  throw env::parser_error{fmt::format(
+                      "Invalid fiber stack size '{}', must be at least {} bytes", repr, min_fiber_stack_size)};
+              }
+              return size;
+          });
+    const auto fiber_stack_report
+        = prefix.register_variable<bool>("FIBER_STACK_REPORT", [](const std::string_view repr) -> bool {
+              if(repr == "0") return false;
+              if(repr == "1") return true;
+              throw env::parser_error{fmt::format("Invalid value '{}', permitted values are '0' and '1'", repr)};
+          });
+
+    const auto async = prefix.register_variable<bool>("ASYNC", [](const std::string_view repr) -> bool {
+        if(repr == "0") return false;
+        if(repr == "1") return true;
+        throw env::parser_error{fmt::format("Invalid value '{}', permitted values are '0' and '1'", repr)};
+    });
 
     if(const auto parsed = prefix.parse_and_validate(); parsed.ok()) {
         parsed_env.emplace(environment{
             .system_config = parsed.get(system),
             .cooperative_schedule = parsed.get_or(schedule, nullptr),
+            .num_worker_threads = parsed.get(threads),
+            .group_major = parsed.get(group_major),
+            .deterministic_reductions = parsed.get(deterministic_reductions),
+            .fiber_budget = parsed.get(fiber_budget),
+            .joint_verification = parsed.get(joint_verification),
+            .atomic_yield = parsed.get(atomic_yield),
+            .fiber_stack_size = parsed.get(fiber_stack_size),
+            .fiber_stack_report = parsed.get(fiber_stack_report),
+            .async = parsed.get(async),
         });
     } else {
         std::cerr << parsed.warning_message() << parsed.error_message();
@@ -352,6 +476,58 @@ std::shared_ptr<const cooperative_schedule> get_default_cooperative_schedule() {
     return s_default_schedule;
 }
 
+size_t get_default_num_worker_threads() {
+    detail::system_lock lock;
+    return detail::parse_environment(lock).num_worker_threads.value_or(1);
+}
+
+bool get_default_group_major_resume_order() {
+    detail::system_lock lock;
+    return detail::parse_environment(lock).group_major.value_or(false);
+}
+
+bool get_default_deterministic_reductions() {
+    detail::system_lock lock;
+    return detail::parse_environment(lock).deterministic_reductions.value_or(false);
+}
+
+std::optional<size_t> get_default_fiber_budget() {
+    detail::system_lock lock;
+    return detail::parse_environment(lock).fiber_budget;
+}
+
+joint_algorithm_verification get_default_joint_algorithm_verification() {
+    detail::system_lock lock;
+    return detail::parse_environment(lock).joint_verification.value_or(joint_algorithm_verification::all_work_items);
+}
+
+atomic_yield_policy get_default_atomic_yield_policy() {
+    detail::system_lock lock;
+    const auto &atomic_yield = detail::parse_environment(lock).atomic_yield;
+    return atomic_yield.has_value() ? atomic_yield->first : atomic_yield_policy::always;
+}
+
+size_t get_default_atomic_yield_threshold() {
+    detail::system_lock lock;
+    const auto &atomic_yield = detail::parse_environment(lock).atomic_yield;
+    return atomic_yield.has_value() ? atomic_yield->second : default_atomic_yield_threshold;
+}
+
+size_t get_default_fiber_stack_size() {
+    detail::system_lock lock;
+    return detail::parse_environment(lock).fiber_stack_size.value_or(default_fiber_stack_size);
+}
+
+bool get_default_fiber_stack_usage_tracking() {
+    detail::system_lock lock;
+    return detail::parse_environment(lock).fiber_stack_report.value_or(false);
+}
+
+bool get_default_async_queue_submission() {
+    detail::system_lock lock;
+    return detail::parse_environment(lock).async.value_or(false);
+}
+
 const platform_config builtin_platform{
     .version = "0.1",
     .name = "SimSYCL",
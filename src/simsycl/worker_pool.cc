@@ -0,0 +1,230 @@
+#include "simsycl/detail/worker_pool.hh"
+#include "simsycl/schedule.hh"
+
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace simsycl::detail {
+
+class worker_pool {
+  public:
+    static worker_pool &get() {
+        static worker_pool s_pool;
+        return s_pool;
+    }
+
+    worker_pool() = default;
+    worker_pool(const worker_pool &) = delete;
+    worker_pool(worker_pool &&) = delete;
+    worker_pool &operator=(const worker_pool &) = delete;
+    worker_pool &operator=(worker_pool &&) = delete;
+
+    ~worker_pool() {
+        {
+            std::lock_guard lock(m_mutex);
+            m_shutdown = true;
+        }
+        m_job_available.notify_all();
+        for(auto &thread : m_threads) { thread.join(); }
+    }
+
+    void run(size_t num_workers, const std::function<void(size_t)> &fn) {
+        // the pool only ever executes one job at a time
+        std::lock_guard run_lock(m_run_mutex);
+
+        {
+            std::lock_guard lock(m_mutex);
+            while(m_threads.size() + 1 < num_workers) {
+                m_threads.emplace_back([this, worker_index = m_threads.size() + 1] { work(worker_index); });
+            }
+            m_job = &fn;
+            m_job_num_workers = num_workers;
+            m_job_settings = get_kernel_settings();
+            m_num_workers_pending = num_workers - 1;
+            m_first_exception = nullptr;
+            ++m_generation;
+        }
+        m_job_available.notify_all();
+
+        execute(0, fn);
+
+        std::unique_lock lock(m_mutex);
+        m_job_complete.wait(lock, [this] { return m_num_workers_pending == 0; });
+        m_job = nullptr;
+        if(m_first_exception) { std::rethrow_exception(std::exchange(m_first_exception, nullptr)); }
+    }
+
+  private:
+    std::mutex m_run_mutex;
+    std::mutex m_mutex;
+    std::condition_variable m_job_available;
+    std::condition_variable m_job_complete;
+    std::vector<std::thread> m_threads;
+    const std::function<void(size_t)> *m_job = nullptr;
+    size_t m_job_num_workers = 0;
+    kernel_settings m_job_settings;
+    size_t m_num_workers_pending = 0;
+    uint64_t m_generation = 0;
+    std::exception_ptr m_first_exception;
+    bool m_shutdown = false;
+
+    void execute(size_t worker_index, const std::function<void(size_t)> &fn) {
+        try {
+            fn(worker_index);
+        } catch(...) {
+            std::lock_guard lock(m_mutex);
+            if(!m_first_exception) { m_first_exception = std::current_exception(); }
+        }
+    }
+
+    void work(const size_t worker_index) {
+        uint64_t last_generation = 0;
+        for(;;) {
+            const std::function<void(size_t)> *job = nullptr;
+            {
+                std::unique_lock lock(m_mutex);
+                m_job_available.wait(lock, [&] { return m_shutdown || m_generation != last_generation; });
+                if(m_shutdown) return;
+                last_generation = m_generation;
+                if(worker_index >= m_job_num_workers) continue; // not participating in this job
+                job = m_job;
+                set_kernel_settings(m_job_settings);
+            }
+
+            assert(job != nullptr);
+            execute(worker_index, *job);
+
+            {
+                std::lock_guard lock(m_mutex);
+                assert(m_num_workers_pending > 0);
+                --m_num_workers_pending;
+            }
+            m_job_complete.notify_one();
+        }
+    }
+};
+
+void run_on_worker_threads(const size_t num_workers, const std::function<void(size_t)> &fn) {
+    if(num_workers <= 1) {
+        fn(0);
+        return;
+    }
+    worker_pool::get().run(num_workers, fn);
+}
+
+void construct_worker_pool() { worker_pool::get(); }
+
+namespace {
+
+std::atomic<size_t> g_work_stealing_chunks{0};
+std::atomic<size_t> g_work_stealing_steals{0};
+std::atomic<size_t> g_work_stealing_stolen_chunks{0};
+
+// The tasks [begin, end) not yet claimed by a worker. Both bounds are packed into a single word so that the owner
+// claiming from the front and thieves claiming from the back can never hand out the same task twice.
+class alignas(64) task_range {
+  public:
+    void reset(const size_t begin, const size_t end) { m_bounds.store(pack(begin, end), std::memory_order_release); }
+
+    std::optional<size_t> pop_front() {
+        auto bounds = m_bounds.load(std::memory_order_acquire);
+        for(;;) {
+            const auto [begin, end] = unpack(bounds);
+            if(begin >= end) return std::nullopt;
+            if(m_bounds.compare_exchange_weak(bounds, pack(begin + 1, end), std::memory_order_acq_rel)) return begin;
+        }
+    }
+
+    std::optional<std::pair<size_t, size_t>> steal_back_half() {
+        auto bounds = m_bounds.load(std::memory_order_acquire);
+        for(;;) {
+            const auto [begin, end] = unpack(bounds);
+            if(begin >= end) return std::nullopt;
+            const auto split = end - (end - begin + 1) / 2;
+            if(m_bounds.compare_exchange_weak(bounds, pack(begin, split), std::memory_order_acq_rel)) {
+                return std::pair{split, end};
+            }
+        }
+    }
+
+  private:
+    std::atomic<uint64_t> m_bounds{0};
+
+    static uint64_t pack(const size_t begin, const size_t end) { return uint64_t{begin} << 32 | uint64_t{end}; }
+    static std::pair<size_t, size_t> unpack(const uint64_t bounds) { return {bounds >> 32, bounds & 0xffff'ffff}; }
+};
+
+} // namespace
+
+void run_work_stealing(
+    const size_t num_workers, const size_t num_tasks, const std::function<void(size_t, size_t)> &fn) //
+{
+    if(num_workers <= 1 || num_tasks <= 1) {
+        for(size_t task_index = 0; task_index < num_tasks; ++task_index) { fn(0, task_index); }
+        return;
+    }
+    assert(num_tasks <= 0xffff'ffff);
+
+    std::vector<task_range> ranges(num_workers);
+    for(size_t worker_index = 0; worker_index < num_workers; ++worker_index) {
+        const auto begin = worker_index * num_tasks / num_workers;
+        const auto end = (worker_index + 1) * num_tasks / num_workers;
+        ranges[worker_index].reset(begin, end);
+    }
+
+    run_on_worker_threads(num_workers, [&](const size_t worker_index) {
+        auto &own = ranges[worker_index];
+        uint64_t rng_state = 0x9e37'79b9'7f4a'7c15 * (worker_index + 1);
+        size_t num_chunks = 0;
+        size_t num_steals = 0;
+        size_t num_stolen_chunks = 0;
+        for(;;) {
+            while(const auto task_index = own.pop_front()) {
+                fn(worker_index, *task_index);
+                ++num_chunks;
+            }
+
+            // xorshift64 to pick the first victim, then visit all others in order so we only give up once all are empty
+            rng_state ^= rng_state << 13;
+            rng_state ^= rng_state >> 7;
+            rng_state ^= rng_state << 17;
+            const auto first_victim = rng_state % (num_workers - 1);
+            std::optional<std::pair<size_t, size_t>> stolen;
+            for(size_t i = 0; i < num_workers - 1 && !stolen; ++i) {
+                const auto victim = (worker_index + 1 + (first_victim + i) % (num_workers - 1)) % num_workers;
+                stolen = ranges[victim].steal_back_half();
+            }
+            if(!stolen) break;
+
+            own.reset(stolen->first, stolen->second);
+            ++num_steals;
+            num_stolen_chunks += stolen->second - stolen->first;
+        }
+        g_work_stealing_chunks.fetch_add(num_chunks, std::memory_order_relaxed);
+        g_work_stealing_steals.fetch_add(num_steals, std::memory_order_relaxed);
+        g_work_stealing_stolen_chunks.fetch_add(num_stolen_chunks, std::memory_order_relaxed);
+    });
+}
+
+} // namespace simsycl::detail
+
+namespace simsycl {
+
+work_stealing_statistics get_work_stealing_statistics() {
+    return {
+        .chunks = detail::g_work_stealing_chunks.load(std::memory_order_relaxed),
+        .steals = detail::g_work_stealing_steals.load(std::memory_order_relaxed),
+        .stolen_chunks = detail::g_work_stealing_stolen_chunks.load(std::memory_order_relaxed),
+    };
+}
+
+} // namespace simsycl
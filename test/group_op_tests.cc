@@ -13,20 +13,17 @@ template<sycl::Group G>
 void check_group_op_sequence(const G &g, std::vector<detail::group_operation_id> expected_ids) {
     auto &group_instance = detail::get_concurrent_group(g).instance;
     // remove the potential implicit "exit" operation from the end of the sequence
-    std::vector<detail::group_operation_id> actual_sequence;
-    std::transform(group_instance.operations.begin(), group_instance.operations.end(),
-        std::back_inserter(actual_sequence), [](auto &op) { return op.id; });
-    if(actual_sequence.back() == detail::group_operation_id::exit) { actual_sequence.pop_back(); }
+    auto actual_sequence = group_instance.operations.recorded_ids();
+    if(!actual_sequence.empty() && actual_sequence.back() == detail::group_operation_id::exit) {
+        actual_sequence.pop_back();
+    }
 
     CHECK(actual_sequence.size() == expected_ids.size());
-    for(size_t i = 0; i < expected_ids.size(); ++i) { CHECK(actual_sequence[i] == expected_ids[i]); }
+    for(size_t i = 0; i < std::min(actual_sequence.size(), expected_ids.size()); ++i) {
+        CHECK(actual_sequence[i] == expected_ids[i]);
+    }
 }
 
-#define REPEAT_FOR_ALL_SCHEDULES                                                                                       \
-    std::string schedule = GENERATE(values<std::string>({"round_robin", "shuffle"}));                                  \
-    CAPTURE(schedule);                                                                                                 \
-    if(schedule == "shuffle") { set_cooperative_schedule(std::make_unique<shuffle_schedule>()); }
-
 TEST_CASE("Group barriers behave as expected", "[group_op]") {
     REPEAT_FOR_ALL_SCHEDULES
 
@@ -644,6 +641,131 @@ TEST_CASE("Group scans behave as expected", "[group_op][exclusive_scan_over_grou
     }
 }
 
+TEST_CASE("Group reductions and scans over large groups match sequential results", "[group_op]") {
+    REPEAT_FOR_ALL_SCHEDULES
+
+    const sycl::range<1> local_range(256);
+    std::vector<int> sums(local_range.size());
+    std::vector<int> exclusive(local_range.size());
+    std::vector<int> inclusive(local_range.size());
+    std::vector<int> any(local_range.size());
+    sycl::queue().submit([&](sycl::handler &cgh) {
+        cgh.parallel_for(sycl::nd_range<1>{local_range, local_range}, [&](sycl::nd_item<1> it) {
+            const auto id = it.get_local_linear_id();
+            const auto x = static_cast<int>(id % 7);
+            sums[id] = sycl::reduce_over_group(it.get_group(), x, 3, sycl::plus<int>{});
+            exclusive[id] = sycl::exclusive_scan_over_group(it.get_group(), x, 3, sycl::plus<int>{});
+            inclusive[id] = sycl::inclusive_scan_over_group(it.get_group(), x, sycl::plus<int>{}, 3);
+            any[id] = sycl::any_of_group(it.get_group(), id == 200);
+        });
+    });
+
+    int sum = 3;
+    for(size_t id = 0; id < local_range.size(); ++id) {
+        CHECK(exclusive[id] == sum);
+        sum += static_cast<int>(id % 7);
+        CHECK(inclusive[id] == sum);
+        CHECK(any[id]);
+    }
+    for(size_t id = 0; id < local_range.size(); ++id) { CHECK(sums[id] == sum); }
+}
+
+TEST_CASE("Completed group operations are retired from the group history", "[group_op]") {
+    REPEAT_FOR_ALL_SCHEDULES
+
+    constexpr size_t num_iterations = 1000;
+    size_t max_group_ops_retained = 0;
+    size_t max_sub_group_ops_retained = 0;
+    std::vector<int> sums(16);
+    sycl::queue().submit([&](sycl::handler &cgh) {
+        cgh.parallel_for(sycl::nd_range<1>{16, 8}, [&](sycl::nd_item<1> it) {
+            const auto &group_ops = detail::get_concurrent_group(it.get_group()).instance.operations;
+            const auto &sub_group_ops = detail::get_concurrent_group(it.get_sub_group()).instance.operations;
+            int sum = 0;
+            for(size_t i = 0; i < num_iterations; ++i) {
+                sycl::group_barrier(it.get_group());
+                sum += sycl::reduce_over_group(it.get_sub_group(), 1, sycl::plus<int>{});
+                max_group_ops_retained
+                    = std::max(max_group_ops_retained, group_ops.end_index() - group_ops.begin_index());
+                max_sub_group_ops_retained
+                    = std::max(max_sub_group_ops_retained, sub_group_ops.end_index() - sub_group_ops.begin_index());
+            }
+            sums[it.get_global_linear_id()] = sum;
+        });
+    });
+
+    // items of a group are never more than one operation apart
+    CHECK(max_group_ops_retained <= 2);
+    CHECK(max_sub_group_ops_retained <= 2);
+    const auto sub_group_size = sycl::device().get_info<sycl::info::device::sub_group_sizes>().at(0);
+    for(const auto sum : sums) { CHECK(sum == static_cast<int>(num_iterations * std::min<size_t>(sub_group_size, 8))); }
+}
+
+SIMSYCL_START_IGNORING_DEPRECATIONS
+
+TEST_CASE("Deprecated sub_group member collectives behave as their freestanding counterparts", "[group_op]") {
+    REPEAT_FOR_ALL_SCHEDULES
+
+    test::configure_device_with([](device_config &dev) { dev.sub_group_sizes = {4u}; });
+    int inputs[4] = {1, 2, 3, 4};
+    sycl::queue().submit([&inputs](sycl::handler &cgh) {
+        cgh.parallel_for(sycl::nd_range<1>{8, 8}, [&inputs](sycl::nd_item<1> it) {
+            const auto sg = it.get_sub_group();
+            const auto id = sg.get_local_linear_id();
+            sg.barrier();
+            CHECK(sg.broadcast(inputs[id], sycl::id<1>(2)) == 3);
+            CHECK(sg.reduce(inputs[id], sycl::plus<int>{}) == 10);
+            CHECK(sg.reduce(inputs[id], 5, sycl::plus<int>{}) == 15);
+            CHECK(sg.exclusive_scan(inputs[id], sycl::plus<int>{}) == std::vector<int>({0, 1, 3, 6})[id]);
+            CHECK(sg.exclusive_scan(inputs[id], 5, sycl::plus<int>{}) == std::vector<int>({5, 6, 8, 11})[id]);
+            CHECK(sg.inclusive_scan(inputs[id], sycl::plus<int>{}) == std::vector<int>({1, 3, 6, 10})[id]);
+            CHECK(sg.inclusive_scan(inputs[id], 5, sycl::plus<int>{}) == std::vector<int>({6, 8, 11, 15})[id]);
+            sg.barrier(sycl::access::fence_space::local_space);
+
+            check_group_op_sequence(sg,
+                {detail::group_operation_id::barrier, detail::group_operation_id::broadcast,
+                    detail::group_operation_id::reduce, detail::group_operation_id::reduce,
+                    detail::group_operation_id::exclusive_scan, detail::group_operation_id::exclusive_scan,
+                    detail::group_operation_id::inclusive_scan, detail::group_operation_id::inclusive_scan,
+                    detail::group_operation_id::barrier});
+        });
+    });
+}
+
+SIMSYCL_STOP_IGNORING_DEPRECATIONS
+
+TEST_CASE("Joint group algorithms re-compute results according to the verification mode", "[group_op]") {
+    const auto [verification, expected_evaluations_per_group] = GENERATE(values<std::pair<joint_algorithm_verification,
+        size_t>>({{joint_algorithm_verification::all_work_items, 4}, {joint_algorithm_verification::sampled, 2},
+        {joint_algorithm_verification::none, 1}}));
+    set_joint_algorithm_verification(verification);
+
+    int inputs[4] = {1, 2, 3, 4};
+    size_t num_evaluations = 0;
+    sycl::queue().submit([&](sycl::handler &cgh) {
+        cgh.parallel_for(sycl::nd_range<1>{8, 4}, [&](sycl::nd_item<1> it) {
+            CHECK(sycl::joint_all_of(it.get_group(), inputs, inputs + 4, [&](int i) {
+                ++num_evaluations;
+                return i > 0;
+            }));
+            CHECK(sycl::joint_reduce(it.get_group(), inputs, inputs + 4, sycl::plus<int>{}) == 10);
+            std::vector<int> outputs = {0, 0, 0, 0};
+            sycl::joint_inclusive_scan(it.get_group(), inputs, inputs + 4, outputs.data(), sycl::plus<int>{});
+            CHECK(outputs == std::vector<int>({1, 3, 6, 10}));
+        });
+    });
+    CHECK(num_evaluations == 2 * 4 * expected_evaluations_per_group);
+
+    // the scan result is shared among all items even if it is written over its own input
+    int shared[4] = {1, 2, 3, 4};
+    sycl::queue().submit([&](sycl::handler &cgh) {
+        cgh.parallel_for(sycl::nd_range<1>{4, 4}, [&](sycl::nd_item<1> it) {
+            sycl::joint_exclusive_scan(it.get_group(), shared, shared + 4, shared, sycl::plus<int>{});
+        });
+    });
+    CHECK(std::vector<int>(shared, shared + 4) == std::vector<int>({0, 1, 3, 6}));
+}
+
 TEST_CASE("Divergent group execution is reported", "[check][group_op]") {
     simsycl::detail::override_check_mode check_mode(SIMSYCL_CHECK_THROW);
     REQUIRE_THROWS_WITH(sycl::queue{}.submit([&](sycl::handler &cgh) {
@@ -655,6 +777,33 @@ TEST_CASE("Divergent group execution is reported", "[check][group_op]") {
             "group recorded operation \"barrier\", but work item #1 is trying to perform \"exit\""));
 }
 
+TEST_CASE(
+    "Divergent group execution is reported after work items exited without group operations", "[check][group_op]") {
+    simsycl::detail::override_check_mode check_mode(SIMSYCL_CHECK_THROW);
+    REQUIRE_THROWS_WITH(sycl::queue{}.submit([&](sycl::handler &cgh) {
+        cgh.parallel_for(sycl::nd_range<1>{2, 2}, [](sycl::nd_item<1> it) {
+            if(it.get_global_linear_id() == 1) { group_barrier(it.get_group()); }
+        });
+    }),
+        Catch::Matchers::ContainsSubstring(
+            "group recorded operation \"barrier\", but work item #0 is trying to perform \"exit\""));
+}
+
+TEST_CASE("Divergent group execution is reported when all work items are blocked", "[check][group_op]") {
+    simsycl::detail::override_check_mode check_mode(SIMSYCL_CHECK_THROW);
+    // neither the group nor the sub-group barrier can ever complete, so no work item is able to make progress
+    REQUIRE_THROWS_WITH(sycl::queue{}.submit([&](sycl::handler &cgh) {
+        cgh.parallel_for(sycl::nd_range<1>{2, 2}, [](sycl::nd_item<1> it) {
+            if(it.get_global_linear_id() == 0) {
+                group_barrier(it.get_group());
+            } else {
+                group_barrier(it.get_sub_group());
+            }
+        });
+    }),
+        Catch::Matchers::ContainsSubstring("group operation invalidated by diverging work items"));
+}
+
 
 TEST_CASE("Mismatched parameters for group ops are reported", "[check][group_op]") {
     simsycl::detail::override_check_mode check_mode(SIMSYCL_CHECK_THROW);
@@ -2,6 +2,9 @@
 
 #include <sycl/sycl.hpp>
 
+#include <algorithm>
+#include <thread>
+
 using namespace simsycl;
 
 TEST_CASE("Hierarchical parallel for launches groups", "[hierarchical][parallel_for_work_group]") {
@@ -108,3 +111,35 @@ TEST_CASE("Basic hierarchical parallel for functionality",
         CHECK(test_total == 8 * 8 * value);
     }
 }
+
+TEST_CASE("Hierarchical work groups distributed across worker threads have distinct local and private memories",
+    "[hierarchical][parallel_for_work_group]") {
+    using namespace sycl;
+    simsycl::set_num_worker_threads(4);
+
+    constexpr size_t num_groups = 64;
+    constexpr size_t group_size = 16;
+    const auto stats_before = simsycl::get_work_stealing_statistics();
+
+    // kernels on worker threads must not invoke Catch2 assertions, so we only record mismatches here
+    std::vector<int> num_mismatches(num_groups);
+    queue().submit([&](handler &cgh) {
+        local_accessor<size_t> local{range<1>(group_size), cgh};
+        cgh.parallel_for_work_group(range<1>(num_groups), range<1>(group_size), [=, &num_mismatches](group<1> g) {
+            private_memory<size_t> private_mem(g);
+            g.parallel_for_work_item([&](h_item<1> itm) {
+                private_mem(itm) = g.get_group_linear_id() * group_size + itm.get_local_id(0);
+                local[itm.get_local_id(0)] = private_mem(itm);
+            });
+            // give other workers a chance to overwrite our local memory if it were shared
+            std::this_thread::yield();
+            g.parallel_for_work_item([&](h_item<1> itm) {
+                if(local[itm.get_local_id(0)] != private_mem(itm)) { ++num_mismatches[g.get_group_linear_id()]; }
+            });
+        });
+    });
+
+    const auto stats_after = simsycl::get_work_stealing_statistics();
+    CHECK(std::all_of(num_mismatches.begin(), num_mismatches.end(), [](int n) { return n == 0; }));
+    CHECK(stats_after.chunks - stats_before.chunks == num_groups);
+}
@@ -7,6 +7,11 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <thread>
+
 
 using namespace simsycl;
 
@@ -133,3 +138,675 @@ TEST_CASE("partial sub-groups are generated if local size is not divisible by de
         visited[it.get_global_linear_id()] = true;
     });
 }
+
+TEMPLATE_TEST_CASE_SIG(
+    "parallel_for(range) visits every item exactly once when distributed across worker threads", "[launch]",
+    ((int Dims), Dims), 1, 2, 3) {
+    REPEAT_FOR_ALL_SCHEDULES
+    simsycl::set_num_worker_threads(4);
+
+    // large enough to be split into more chunks than there are threads
+    sycl::range<Dims> range;
+    for(int d = 0; d < Dims; ++d) { range[d] = d == 0 ? 100'000 / (1 << (4 * (Dims - 1))) : 16; }
+    sycl::id<Dims> offset;
+    offset[0] = 7;
+
+    // kernels on worker threads must not invoke Catch2 assertions, so we only record visits here
+    std::vector<int> visits(range.size());
+    std::vector<int> offset_visits(range.size());
+    sycl::queue q;
+    q.parallel_for(range, [=, &visits](sycl::item<Dims> it) { ++visits[it.get_linear_id()]; });
+    SIMSYCL_START_IGNORING_DEPRECATIONS
+    q.submit([&](sycl::handler &cgh) {
+        cgh.parallel_for(range, offset, [=, &offset_visits](sycl::item<Dims> it) {
+            ++offset_visits[simsycl::detail::get_linear_index(range, it.get_id() - offset)];
+        });
+    });
+    SIMSYCL_STOP_IGNORING_DEPRECATIONS
+
+    CHECK(std::all_of(visits.begin(), visits.end(), [](int v) { return v == 1; }));
+    CHECK(std::all_of(offset_visits.begin(), offset_visits.end(), [](int v) { return v == 1; }));
+}
+
+TEST_CASE("parallel_for(range) generates consistent ids across schedule chunk boundaries", "[launch]") {
+    REPEAT_FOR_ALL_SCHEDULES
+
+    // not a multiple of the schedule chunk size, and chunks start in the middle of rows
+    const sycl::range<3> range(5, 97, 41);
+    const sycl::id<3> offset(3, 2, 1);
+    std::vector<int> visits(range.size());
+    size_t num_inconsistent_items = 0;
+    sycl::queue q;
+    SIMSYCL_START_IGNORING_DEPRECATIONS
+    q.submit([&](sycl::handler &cgh) {
+        cgh.parallel_for(range, offset, [&](sycl::item<3, true> it) {
+            const auto linear_id = simsycl::detail::get_linear_index(range, it.get_id() - offset);
+            if(simsycl::detail::linear_index_to_id(range, linear_id) + offset != it.get_id()) {
+                ++num_inconsistent_items;
+            }
+            ++visits[linear_id];
+        });
+    });
+    SIMSYCL_STOP_IGNORING_DEPRECATIONS
+
+    CHECK(num_inconsistent_items == 0);
+    CHECK(std::all_of(visits.begin(), visits.end(), [](int v) { return v == 1; }));
+}
+
+TEST_CASE("morton_schedule and tiled_schedule traverse multi-dimensional ranges spatially", "[launch]") {
+    const auto record_order = [](const sycl::range<2> &range) {
+        std::vector<sycl::id<2>> order;
+        sycl::queue().parallel_for(range, [&](sycl::item<2> it) { order.push_back(it.get_id()); });
+        return order;
+    };
+
+    SECTION("morton_schedule visits square power-of-two ranges in Z-order") {
+        simsycl::set_cooperative_schedule(std::make_unique<simsycl::morton_schedule>());
+        const auto order = record_order(sycl::range<2>(8, 8));
+        REQUIRE(order.size() == 64);
+        for(size_t position = 0; position < order.size(); ++position) {
+            CAPTURE(position);
+            // de-interleave the bits of the position, with dimension 0 in the more significant bit of each pair
+            sycl::id<2> expected_id;
+            for(size_t bit = 0; bit < 3; ++bit) {
+                expected_id[0] |= (position >> (2 * bit + 1) & 1) << bit;
+                expected_id[1] |= (position >> (2 * bit) & 1) << bit;
+            }
+            CHECK(order[position] == expected_id);
+        }
+    }
+
+    SECTION("tiled_schedule visits tiles in row-major order, and each tile in row-major order") {
+        simsycl::set_cooperative_schedule(std::make_unique<simsycl::tiled_schedule>(4));
+        // 2x2 tiles, with partial tiles at the end of both dimensions
+        const auto order = record_order(sycl::range<2>(3, 5));
+        const std::vector<sycl::id<2>> expected_order{{0, 0}, {0, 1}, {1, 0}, {1, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3},
+            {0, 4}, {1, 4}, {2, 0}, {2, 1}, {2, 2}, {2, 3}, {2, 4}};
+        CHECK(order == expected_order);
+    }
+}
+
+TEST_CASE("permutation_schedule generates permutations of arbitrary size", "[launch]") {
+    const simsycl::permutation_schedule schedule(42);
+    for(const size_t size : {1, 2, 3, 5, 16, 17, 1000, 4097}) {
+        CAPTURE(size);
+        std::vector<size_t> order(size);
+        auto state = schedule.init(order);
+        for(int round = 0; round < 3; ++round) {
+            CAPTURE(round);
+            std::vector<bool> visited(size);
+            for(size_t position = 0; position < size; ++position) {
+                const auto index = schedule.get_index(state, size, position);
+                CHECK(order[position] == index);
+                REQUIRE(index < size);
+                CHECK(!visited[index]);
+                visited[index] = true;
+            }
+            state = schedule.update(state, order);
+        }
+    }
+}
+
+TEST_CASE("exceptions thrown from kernels on worker threads are propagated to the submitting thread", "[launch]") {
+    simsycl::set_num_worker_threads(4);
+    CHECK_THROWS(sycl::queue().parallel_for(sycl::range<1>(100'000), [](sycl::item<1> it) {
+        if(it.get_linear_id() == 99'999) throw std::runtime_error("kernel failure");
+    }));
+}
+
+TEST_CASE("parallel_for(range) worker threads steal chunks from a thread blocked on an expensive item", "[launch]") {
+    simsycl::set_num_worker_threads(4);
+
+    // the first thread initially owns a quarter of the range, so the first item can only wait for 7/8 of the items to
+    // complete if the remaining chunks of its thread are stolen. The deadline turns a missing steal into a test failure
+    // instead of a hang.
+    const size_t range_size = 16 << 10;
+    const size_t num_awaited = range_size * 7 / 8;
+    std::atomic<size_t> num_completed{0};
+    size_t num_completed_before_first = 0;
+    const auto stats_before = simsycl::get_work_stealing_statistics();
+    sycl::queue().parallel_for(sycl::range<1>(range_size), [&](sycl::item<1> it) {
+        if(it.get_linear_id() == 0) {
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while(num_completed.load() < num_awaited && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::yield();
+            }
+            num_completed_before_first = num_completed.load();
+        }
+        num_completed.fetch_add(1);
+    });
+    const auto stats_after = simsycl::get_work_stealing_statistics();
+
+    CHECK(num_completed_before_first >= num_awaited);
+    CHECK(stats_after.steals > stats_before.steals);
+    CHECK(stats_after.stolen_chunks - stats_before.stolen_chunks >= stats_after.steals - stats_before.steals);
+    CHECK(stats_after.chunks - stats_before.chunks == 16 * 4);
+}
+
+TEST_CASE("atomic_ref operations are atomic across worker threads", "[launch]") {
+    simsycl::set_num_worker_threads(4);
+
+    constexpr size_t num_items = 100'000;
+    constexpr size_t num_bins = 7;
+    std::vector<unsigned> histogram(num_bins);
+    int counter = 0;
+    float max_value = 0;
+    sycl::queue().parallel_for(sycl::range<1>(num_items), [&](sycl::item<1> it) {
+        using relaxed_ref = sycl::atomic_ref<unsigned, sycl::memory_order::relaxed, sycl::memory_scope::device>;
+        relaxed_ref(histogram[it.get_linear_id() % num_bins]) += 1;
+        sycl::atomic_ref<int, sycl::memory_order::acq_rel, sycl::memory_scope::device>(counter).fetch_add(1);
+        sycl::atomic_ref<float, sycl::memory_order::relaxed, sycl::memory_scope::device>(max_value).fetch_max(
+            static_cast<float>(it.get_linear_id()));
+    });
+
+    for(size_t bin = 0; bin < num_bins; ++bin) {
+        CHECK(histogram[bin] == num_items / num_bins + (bin < num_items % num_bins ? 1 : 0));
+    }
+    CHECK(counter == static_cast<int>(num_items));
+    CHECK(max_value == static_cast<float>(num_items - 1));
+}
+
+TEST_CASE("nd_range work items spin-waiting on atomics make progress under every yielding policy", "[launch]") {
+    const auto policy = GENERATE(values<simsycl::atomic_yield_policy>({simsycl::atomic_yield_policy::always,
+        simsycl::atomic_yield_policy::interval, simsycl::atomic_yield_policy::on_spin}));
+    simsycl::set_atomic_yield_policy(policy, 16);
+    // wait loops polling a single atomic, two atomics alternately, or a plain value ordered by fences
+    const auto wait = GENERATE(values<std::string>({"one atomic", "two atomics", "fence"}));
+    CAPTURE(wait);
+
+    // The first work item of each group waits for the last one, and the second-to-last for the last one. The first
+    // item is the probe of the barrier-free fast path, and the second-to-last executes as a plain call within it.
+    constexpr size_t num_groups = 4;
+    constexpr size_t group_size = 8;
+    std::vector<int> flags(num_groups);
+    std::vector<int> unset_flags(num_groups);
+    std::vector<int> plain_flags(num_groups);
+    std::vector<int> observed(num_groups * group_size);
+    sycl::queue().parallel_for(sycl::nd_range<1>(num_groups * group_size, group_size), [&](sycl::nd_item<1> it) {
+        using flag_ref = sycl::atomic_ref<int, sycl::memory_order::acq_rel, sycl::memory_scope::work_group>;
+        flag_ref flag(flags[it.get_group_linear_id()]);
+        flag_ref unset_flag(unset_flags[it.get_group_linear_id()]);
+        auto &plain_flag = plain_flags[it.get_group_linear_id()];
+        const auto local_id = it.get_local_linear_id();
+        if(local_id == group_size - 1) {
+            plain_flag = 1;
+            flag.store(1);
+        } else if(local_id == 0 || local_id == group_size - 2) {
+            if(wait == "one atomic") {
+                while(flag.load() == 0) {}
+            } else if(wait == "two atomics") {
+                while(unset_flag.load() == 0 && flag.load() == 0) {}
+            } else {
+                while(plain_flag == 0) {
+                    sycl::atomic_fence(sycl::memory_order::acq_rel, sycl::memory_scope::work_group);
+                }
+            }
+        }
+        observed[it.get_global_linear_id()] = flag.load();
+    });
+    for(size_t i = 0; i < num_groups * group_size; ++i) {
+        if(i % group_size == 0 || i % group_size >= group_size - 2) { CHECK(observed[i] == 1); }
+    }
+}
+
+TEST_CASE("nd_range work items spin-waiting on another concurrent group make progress", "[launch]") {
+    const auto policy = GENERATE(values<simsycl::atomic_yield_policy>({simsycl::atomic_yield_policy::always,
+        simsycl::atomic_yield_policy::interval, simsycl::atomic_yield_policy::on_spin}));
+    simsycl::set_atomic_yield_policy(policy, 16);
+
+    // The second item of each group performs a flag handshake with the second item of the other group. The first item
+    // does not touch any atomic, so it is the probe of the barrier-free fast path, and the handshake only starts once
+    // groups are executed as plain calls from the runner.
+    constexpr size_t num_groups = 2;
+    constexpr size_t group_size = 8;
+    int ping = 0;
+    int pong = 0;
+    std::vector<int> observed(num_groups);
+    sycl::queue().parallel_for(sycl::nd_range<1>(num_groups * group_size, group_size), [&](sycl::nd_item<1> it) {
+        if(it.get_local_linear_id() != 1) return;
+        using flag_ref = sycl::atomic_ref<int, sycl::memory_order::acq_rel, sycl::memory_scope::device>;
+        if(it.get_group_linear_id() == 0) {
+            flag_ref(ping).store(1);
+            while(flag_ref(pong).load() == 0) {}
+            observed[0] = flag_ref(pong).load();
+        } else {
+            while(flag_ref(ping).load() == 0) {}
+            observed[1] = flag_ref(ping).load();
+            flag_ref(pong).store(1);
+        }
+    });
+    CHECK(observed[0] == 1);
+    CHECK(observed[1] == 1);
+}
+
+TEST_CASE("nd_range work items reading the same unchanged atomic are not considered to be spinning", "[launch]") {
+    simsycl::set_atomic_yield_policy(simsycl::atomic_yield_policy::on_spin, 16);
+
+    int flag = 1;
+    const auto before = simsycl::get_fiber_stack_pool_statistics();
+    sycl::queue()
+        .parallel_for(sycl::nd_range<1>(256, 64),
+            [&](sycl::nd_item<1> /* it */) {
+                sycl::atomic_ref<int, sycl::memory_order::relaxed, sycl::memory_scope::device> ref(flag);
+                for(int i = 0; i < 4; ++i) { (void)ref.load(); }
+            })
+        .wait();
+    const auto after = simsycl::get_fiber_stack_pool_statistics();
+
+    // no work item yielded, so the barrier-free fast path executed them all from a single runner fiber
+    CHECK(after.hits + after.misses - before.hits - before.misses == 2);
+}
+
+TEST_CASE("nd_range kernels with reductions are not split across worker threads", "[launch]") {
+    simsycl::set_num_worker_threads(4);
+
+    constexpr size_t num_items = 10'000;
+    int64_t sum = 0;
+    sycl::queue().parallel_for(sycl::nd_range<1>(num_items, 10), sycl::reduction(&sum, sycl::plus<int64_t>{}),
+        [](sycl::nd_item<1> it, auto &sum_reducer) { sum_reducer += static_cast<int64_t>(it.get_global_linear_id()); });
+
+    CHECK(sum == static_cast<int64_t>(num_items * (num_items - 1) / 2));
+}
+
+TEST_CASE("nd_range work groups distributed across worker threads have distinct local memories", "[launch]") {
+    REPEAT_FOR_ALL_SCHEDULES
+    simsycl::set_num_worker_threads(4);
+
+    // more groups than the builtin device has compute units, so each concurrent group executes multiple groups
+    const sycl::range<1> local_range(32);
+    const sycl::range<1> global_range(local_range * 50);
+
+    // kernels on worker threads must not invoke Catch2 assertions, so we only record results here
+    std::vector<size_t> buddy_values(global_range.size());
+    std::vector<size_t> group_sums(global_range.size());
+    std::vector<size_t> sub_group_sums(global_range.size());
+    sycl::queue()
+        .submit([&](sycl::handler &cgh) {
+            sycl::local_accessor<size_t> a{local_range, cgh};
+            cgh.parallel_for(sycl::nd_range(global_range, local_range), [=, &buddy_values, &group_sums,
+                                                                            &sub_group_sums](sycl::nd_item<1> it) {
+                const auto global_id = it.get_global_linear_id();
+                a[it.get_local_linear_id()] = global_id;
+                sycl::group_barrier(it.get_group());
+                buddy_values[global_id] = a[it.get_local_linear_id() ^ 1];
+                group_sums[global_id] = sycl::reduce_over_group(it.get_group(), global_id, sycl::plus<size_t>());
+                sub_group_sums[global_id]
+                    = sycl::reduce_over_group(it.get_sub_group(), global_id, sycl::plus<size_t>());
+            });
+        })
+        .wait();
+
+    const auto sub_group_size = sycl::device().get_info<sycl::info::device::sub_group_sizes>().at(0);
+    for(size_t global_id = 0; global_id < global_range.size(); ++global_id) {
+        CAPTURE(global_id);
+        CHECK(buddy_values[global_id] == (global_id ^ 1));
+        const auto group_begin = global_id / local_range.size() * local_range.size();
+        CHECK(group_sums[global_id] == local_range.size() * (2 * group_begin + local_range.size() - 1) / 2);
+        const auto sub_group_begin = global_id / sub_group_size * sub_group_size;
+        CHECK(sub_group_sums[global_id] == sub_group_size * (2 * sub_group_begin + sub_group_size - 1) / 2);
+    }
+}
+
+TEST_CASE("nd_range work items of concurrent groups are resumed one group at a time in group-major order", "[launch]") {
+    REPEAT_FOR_ALL_SCHEDULES
+    simsycl::set_group_major_resume_order(true);
+
+    const sycl::range<1> local_range(8);
+    const sycl::range<1> global_range(local_range * 4);
+    std::vector<size_t> group_ids_before_barrier;
+    std::vector<size_t> group_ids_after_barrier;
+    std::vector<size_t> buddy_values(global_range.size());
+    sycl::queue()
+        .submit([&](sycl::handler &cgh) {
+            sycl::local_accessor<size_t> a{local_range, cgh};
+            sycl::local_accessor<size_t> b{local_range, cgh};
+            cgh.parallel_for(sycl::nd_range(global_range, local_range), [&, a, b](sycl::nd_item<1> it) {
+                const auto local_id = it.get_local_linear_id();
+                group_ids_before_barrier.push_back(it.get_group_linear_id());
+                a[local_id] = it.get_global_linear_id();
+                b[local_id ^ 1] = it.get_global_linear_id();
+                sycl::group_barrier(it.get_group());
+                group_ids_after_barrier.push_back(it.get_group_linear_id());
+                CHECK(a[local_id ^ 1] == b[local_id]);
+                buddy_values[it.get_global_linear_id()] = a[local_id ^ 1];
+            });
+        })
+        .wait();
+
+    for(const auto *group_ids : {&group_ids_before_barrier, &group_ids_after_barrier}) {
+        REQUIRE(group_ids->size() == global_range.size());
+        CHECK(std::is_sorted(group_ids->begin(), group_ids->end()));
+    }
+    for(size_t global_id = 0; global_id < global_range.size(); ++global_id) {
+        CHECK(buddy_values[global_id] == (global_id ^ 1));
+    }
+}
+
+TEST_CASE("nd_range work items waiting on an incomplete barrier are not resumed before it completes", "[launch]") {
+    REPEAT_FOR_ALL_SCHEDULES
+    simsycl::set_atomic_yield_policy(simsycl::atomic_yield_policy::always);
+
+    // The last work item yields on each of many atomic operations before reaching the barrier all other items of the
+    // group are waiting on.
+    constexpr size_t group_size = 16;
+    constexpr int num_late_operations = 200;
+    int counter = 0;
+    const auto suspensions_before = simsycl::detail::get_num_kernel_suspensions();
+    sycl::queue()
+        .parallel_for(sycl::nd_range<1>(group_size, group_size),
+            [&](sycl::nd_item<1> it) {
+                if(it.get_local_linear_id() == group_size - 1) {
+                    sycl::atomic_ref<int, sycl::memory_order::relaxed, sycl::memory_scope::work_group> ref(counter);
+                    for(int i = 0; i < num_late_operations; ++i) { ref.fetch_add(1); }
+                }
+                sycl::group_barrier(it.get_group());
+            })
+        .wait();
+    const auto suspensions = simsycl::detail::get_num_kernel_suspensions() - suspensions_before;
+
+    CHECK(counter == num_late_operations);
+    // Every item suspends on the barrier and on the implicit group and sub-group exit operations. Resuming the waiting
+    // items while the late one is still on its way would suspend each of them again after every atomic operation.
+    CHECK(suspensions <= num_late_operations + (4 * group_size));
+}
+
+TEST_CASE("fiber stacks are re-used across nd_range launches", "[launch]") {
+    const sycl::nd_range<1> range(256, 64);
+    const auto launch = [&] {
+        sycl::queue().parallel_for(range, [](sycl::nd_item<1> it) { sycl::group_barrier(it.get_group()); }).wait();
+    };
+
+    launch();
+    const auto before = simsycl::get_fiber_stack_pool_statistics();
+    launch();
+    const auto after = simsycl::get_fiber_stack_pool_statistics();
+    CHECK(after.hits - before.hits == range.get_global_range().size());
+    CHECK(after.misses == before.misses);
+}
+
+TEST_CASE("fiber stacks exceeding the needs of a launch are released", "[launch]") {
+    const auto launch = [](const size_t global_size) {
+        sycl::queue()
+            .parallel_for(sycl::nd_range<1>(global_size, 64),
+                [](sycl::nd_item<1> it) { sycl::group_barrier(it.get_group()); })
+            .wait();
+    };
+
+    launch(1024);
+    launch(64);
+    const auto before = simsycl::get_fiber_stack_pool_statistics();
+    launch(1024);
+    const auto after = simsycl::get_fiber_stack_pool_statistics();
+    CHECK(after.misses > before.misses);
+}
+
+template<size_t Size>
+std::byte touch_stack_array() {
+    volatile std::byte array[Size];
+    for(size_t i = 0; i < Size; i += 64) { array[i] = std::byte{1}; }
+    return array[0];
+}
+
+TEST_CASE("peak fiber stack usage is reported per kernel", "[launch]") {
+    simsycl::set_fiber_stack_usage_tracking(true);
+
+    const sycl::nd_range<1> range(64, 16);
+    sycl::queue q;
+    q.parallel_for<class small_stack_kernel>(range, [](sycl::nd_item<1> it) { (void)it; });
+    q.parallel_for<class large_stack_kernel>(range, [](sycl::nd_item<1> it) {
+        if(it.get_global_linear_id() == 5) (void)touch_stack_array<64 << 10>();
+    });
+
+    const auto usage = simsycl::get_fiber_stack_usage();
+    const auto find_usage = [&](const std::string_view name) {
+        const auto it = std::find_if(usage.begin(), usage.end(),
+            [&](const simsycl::fiber_stack_usage &u) { return u.kernel_name.find(name) != std::string::npos; });
+        REQUIRE(it != usage.end());
+        return *it;
+    };
+    const auto small = find_usage("small_stack_kernel");
+    const auto large = find_usage("large_stack_kernel");
+    CHECK(small.stack_size == simsycl::default_fiber_stack_size);
+    CHECK(small.peak_usage > 0);
+    CHECK(small.peak_usage < 16 << 10);
+    CHECK(large.peak_usage >= 64 << 10);
+    CHECK(large.peak_usage < simsycl::default_fiber_stack_size);
+}
+
+TEST_CASE("fiber stack size can be increased for kernels with large stack frames", "[launch]") {
+    simsycl::set_fiber_stack_size(1 << 20);
+    simsycl::set_fiber_stack_usage_tracking(true);
+
+    size_t num_items = 0;
+    sycl::queue().parallel_for<class huge_stack_kernel>(sycl::nd_range<1>(32, 16), [&](sycl::nd_item<1> it) {
+        (void)it;
+        (void)touch_stack_array<512 << 10>();
+        ++num_items;
+    });
+    CHECK(num_items == 32);
+
+    const auto usage = simsycl::get_fiber_stack_usage();
+    const auto it = std::find_if(usage.begin(), usage.end(), [](const simsycl::fiber_stack_usage &u) {
+        return u.kernel_name.find("huge_stack_kernel") != std::string::npos;
+    });
+    REQUIRE(it != usage.end());
+    CHECK(it->stack_size == 1 << 20);
+    CHECK(it->peak_usage >= 512 << 10);
+}
+
+TEST_CASE("the number of concurrent nd_range work groups is limited by the fiber budget", "[launch]") {
+    const auto compute_units = GENERATE(values<uint32_t>({1, 4, 1000}));
+    const auto fiber_budget = GENERATE(values<size_t>({0 /* none */, 10, 48, 1 << 20}));
+    CAPTURE(compute_units, fiber_budget);
+    simsycl::test::configure_device_with([=](simsycl::device_config &device) {
+        device.max_compute_units = compute_units;
+    });
+    if(fiber_budget > 0) { simsycl::set_fiber_budget(fiber_budget); }
+
+    const sycl::range<1> local_range(16);
+    const sycl::range<1> global_range(local_range * 64);
+    std::vector<size_t> buddy_values(global_range.size());
+    const auto stats_before = simsycl::get_fiber_stack_pool_statistics();
+    sycl::queue().submit([&](sycl::handler &cgh) {
+        sycl::local_accessor<size_t> local{local_range, cgh};
+        cgh.parallel_for(sycl::nd_range(global_range, local_range), [=, &buddy_values](sycl::nd_item<1> it) {
+            local[it.get_local_linear_id()] = it.get_global_linear_id();
+            sycl::group_barrier(it.get_group());
+            buddy_values[it.get_global_linear_id()] = local[it.get_local_linear_id() ^ 1];
+        });
+    });
+    const auto stats_after = simsycl::get_fiber_stack_pool_statistics();
+
+    // every concurrently executing work item owns one fiber stack
+    const auto num_fibers = (stats_after.hits + stats_after.misses) - (stats_before.hits + stats_before.misses);
+    const size_t expected_concurrent_groups
+        = fiber_budget > 0 ? std::clamp<size_t>(fiber_budget / 16, 1, 64) : std::min<size_t>(compute_units, 64);
+    CHECK(num_fibers == expected_concurrent_groups * local_range.size());
+    for(size_t global_id = 0; global_id < global_range.size(); ++global_id) {
+        CHECK(buddy_values[global_id] == (global_id ^ 1));
+    }
+}
+
+TEST_CASE("repeated nd_range launches of the same shape re-use their group state and local memory", "[launch]") {
+    const sycl::range<1> global_range(256);
+    const auto launch = [&](const sycl::range<1> &local_range) {
+        std::vector<size_t> buddy_values(global_range.size());
+        const size_t *local_address = nullptr;
+        sycl::queue().submit([&](sycl::handler &cgh) {
+            sycl::local_accessor<size_t> local{local_range, cgh};
+            cgh.parallel_for(sycl::nd_range(global_range, local_range),
+                [=, &buddy_values, &local_address](sycl::nd_item<1> it) {
+                    if(it.get_global_linear_id() == 0) { local_address = &local[0]; }
+                    local[it.get_local_linear_id()] = it.get_global_linear_id();
+                    sycl::group_barrier(it.get_group());
+                    buddy_values[it.get_global_linear_id()] = local[it.get_local_linear_id() ^ 1];
+                });
+        });
+        for(size_t global_id = 0; global_id < global_range.size(); ++global_id) {
+            CHECK(buddy_values[global_id] == (global_id ^ 1));
+        }
+        return local_address;
+    };
+
+    const auto first_address = launch(sycl::range<1>(16));
+    CHECK(launch(sycl::range<1>(16)) == first_address);
+    launch(sycl::range<1>(32));
+    simsycl::set_group_major_resume_order(true);
+    CHECK(launch(sycl::range<1>(16)) == first_address);
+}
+
+TEST_CASE("nd_range kernels without group operations execute without a fiber per work item", "[launch]") {
+    REPEAT_FOR_ALL_SCHEDULES
+
+    const sycl::range<2> local_range(8, 8);
+    const sycl::range<2> global_range(local_range * sycl::range<2>(8, 4));
+    std::vector<int> visits(global_range.size());
+    std::vector<size_t> local_values(global_range.size());
+
+    const auto before = simsycl::get_fiber_stack_pool_statistics();
+    sycl::queue()
+        .submit([&](sycl::handler &cgh) {
+            sycl::local_accessor<size_t, 2> local{local_range, cgh};
+            cgh.parallel_for(
+                sycl::nd_range(global_range, local_range), [=, &visits, &local_values](sycl::nd_item<2> it) {
+                    const auto global_linear_id = it.get_global_linear_id();
+                    ++visits[global_linear_id];
+                    local[it.get_local_id()] = global_linear_id;
+                    local_values[global_linear_id] = local[it.get_local_id()];
+                });
+        })
+        .wait();
+    const auto after = simsycl::get_fiber_stack_pool_statistics();
+
+    // one fiber for the first work item, one for executing all remaining ones
+    CHECK(after.hits + after.misses - before.hits - before.misses == 2);
+    for(size_t i = 0; i < global_range.size(); ++i) {
+        CAPTURE(i);
+        CHECK(visits[i] == 1);
+        CHECK(local_values[i] == i);
+    }
+}
+
+TEST_CASE("nd_range kernels with group operations in only some groups or sub-groups execute correctly", "[launch]") {
+    REPEAT_FOR_ALL_SCHEDULES
+    const auto num_threads = GENERATE(values<size_t>({1, 4}));
+    CAPTURE(num_threads);
+    simsycl::set_num_worker_threads(num_threads);
+
+    const auto sub_group_size = sycl::device().get_info<sycl::info::device::sub_group_sizes>().at(0);
+    const sycl::range<1> local_range(2 * sub_group_size);
+    const sycl::range<1> global_range(local_range * 40);
+    std::vector<size_t> buddy_values(global_range.size());
+    std::vector<size_t> sub_group_sums(global_range.size());
+
+    sycl::queue()
+        .submit([&](sycl::handler &cgh) {
+            sycl::local_accessor<size_t> local{local_range, cgh};
+            cgh.parallel_for(
+                sycl::nd_range(global_range, local_range), [=, &buddy_values, &sub_group_sums](sycl::nd_item<1> it) {
+                    const auto global_id = it.get_global_linear_id();
+                    const auto group_id = it.get_group_linear_id();
+                    if(group_id % 3 == 1) {
+                        local[it.get_local_linear_id()] = global_id;
+                        sycl::group_barrier(it.get_group());
+                        buddy_values[global_id] = local[it.get_local_linear_id() ^ 1];
+                    }
+                    if(group_id % 3 == 2 && it.get_sub_group().get_group_linear_id() == 1) {
+                        sub_group_sums[global_id]
+                            = sycl::reduce_over_group(it.get_sub_group(), global_id, sycl::plus<size_t>());
+                    }
+                });
+        })
+        .wait();
+
+    for(size_t global_id = 0; global_id < global_range.size(); ++global_id) {
+        CAPTURE(global_id);
+        const auto group_id = global_id / local_range.size();
+        const auto sub_group_begin = global_id / sub_group_size * sub_group_size;
+        const auto is_second_sub_group = global_id % local_range.size() >= sub_group_size;
+        CHECK(buddy_values[global_id] == (group_id % 3 == 1 ? global_id ^ 1 : 0));
+        CHECK(sub_group_sums[global_id]
+            == (group_id % 3 == 2 && is_second_sub_group
+                    ? sub_group_size * (2 * sub_group_begin + sub_group_size - 1) / 2
+                    : 0));
+    }
+}
+
+TEST_CASE("Asynchronous queue submissions execute on a background thread and report their progress", "[launch]") {
+    simsycl::set_async_queue_submission(true);
+    simsycl::set_num_worker_threads(2);
+
+    std::vector<int> data(256, 0);
+    std::optional<sycl::buffer<int>> buf(sycl::range<1>(data.size()));
+    buf->set_final_data(data.data());
+
+    // the background thread holds the system lock while executing a kernel, so the host thread must not create
+    // buffers or accessors until the blocking kernel has been released
+    std::atomic<bool> released{false};
+    std::thread::id kernel_thread;
+    size_t kernel_num_worker_threads = 0;
+    sycl::queue q;
+    auto blocked = q.single_task([released = &released, kernel_thread = &kernel_thread,
+                                     kernel_num_worker_threads = &kernel_num_worker_threads] {
+        *kernel_thread = std::this_thread::get_id();
+        *kernel_num_worker_threads = simsycl::get_num_worker_threads();
+        while(!released->load()) { std::this_thread::yield(); }
+    });
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while(blocked.get_info<sycl::info::event::command_execution_status>() != sycl::info::event_command_status::running
+        && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    CHECK(blocked.get_info<sycl::info::event::command_execution_status>() == sycl::info::event_command_status::running);
+
+    auto filled = q.submit([buf = *buf](sycl::handler &cgh) mutable {
+        sycl::accessor acc(buf, cgh, sycl::write_only);
+        cgh.parallel_for(buf.get_range(), [=](sycl::item<1> item) { acc[item] = static_cast<int>(item[0]); });
+    });
+    CHECK(filled.get_info<sycl::info::event::command_execution_status>()
+        == sycl::info::event_command_status::submitted);
+
+    released = true;
+    {
+        sycl::host_accessor host_acc(*buf, sycl::read_only);
+        CHECK(blocked.get_info<sycl::info::event::command_execution_status>()
+            == sycl::info::event_command_status::complete);
+        CHECK(filled.get_info<sycl::info::event::command_execution_status>()
+            == sycl::info::event_command_status::complete);
+        CHECK(host_acc[255] == 255);
+    }
+    buf.reset();
+    CHECK(kernel_thread != std::this_thread::get_id());
+    CHECK(kernel_num_worker_threads == 2);
+    for(size_t i = 0; i < data.size(); ++i) { CHECK(data[i] == static_cast<int>(i)); }
+
+    q.wait();
+    CHECK(blocked.get_profiling_info<sycl::info::event_profiling::command_start>()
+        >= blocked.get_profiling_info<sycl::info::event_profiling::command_submit>());
+    CHECK(blocked.get_profiling_info<sycl::info::event_profiling::command_end>()
+        >= blocked.get_profiling_info<sycl::info::event_profiling::command_start>());
+}
+
+TEST_CASE("Exceptions thrown by asynchronous submissions are passed to the async handler", "[launch]") {
+    simsycl::set_async_queue_submission(true);
+
+    size_t num_exceptions = 0;
+    sycl::queue q([&](const sycl::exception_list &exceptions) { num_exceptions += exceptions.size(); });
+    q.submit([](sycl::handler & /* cgh */) { throw std::runtime_error("command group failure"); });
+    q.single_task([] {});
+    CHECK(num_exceptions == 0);
+
+    q.wait_and_throw();
+    CHECK(num_exceptions == 1);
+    q.wait_and_throw();
+    CHECK(num_exceptions == 1);
+
+    auto failed = q.submit([](sycl::handler & /* cgh */) { throw std::runtime_error("command group failure"); });
+    failed.wait_and_throw();
+    CHECK(num_exceptions == 2);
+
+    failed = q.submit([](sycl::handler & /* cgh */) { throw std::runtime_error("command group failure"); });
+    sycl::event::wait_and_throw({failed, q.single_task([] {})});
+    CHECK(num_exceptions == 3);
+}
@@ -1,8 +1,15 @@
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 
+#include <simsycl/schedule.hh>
 #include <sycl/sycl.hpp>
 
+#include <array>
+#include <memory>
+#include <string>
+#include <tuple>
+
 using namespace simsycl;
 
 
@@ -66,3 +73,78 @@ TEMPLATE_TEST_CASE(
     CHECK(min_var == -4.0f);
     CHECK(max_var == 9.0f);
 }
+
+TEMPLATE_TEST_CASE(
+    "span reductions combine each element independently", "[reduction]", basic_parallel_for_wrapper,
+    nd_range_parallel_for_wrapper) {
+    std::array<int, 4> sums{1, 2, 3, 4};
+    std::array<int, 3> maxima{};
+
+    sycl::queue().parallel_for(TestType::make_range(100),
+        sycl::reduction(sycl::span<int, 4>(sums), sycl::plus<int>{}),
+        sycl::reduction(sycl::span<int, 3>(maxima), sycl::maximum<int>{},
+            sycl::property::reduction::initialize_to_identity{}),
+        [=](auto item, auto &sum, auto &max) {
+            const int linear_id = static_cast<int>(TestType::get_linear_id(item));
+            sum[linear_id % 4] += linear_id;
+            max[linear_id % 3].combine(linear_id);
+        });
+
+    CHECK(sums == std::array<int, 4>{1 + 1200, 2 + 1225, 3 + 1250, 4 + 1275});
+    CHECK(maxima == std::array<int, 3>{99, 97, 98});
+}
+
+TEST_CASE("reductions in basic parallel_for kernels are combined from per-thread partial results", "[reduction]") {
+    const size_t num_threads = GENERATE(values<size_t>({1, 2, 3, 8}));
+    CAPTURE(num_threads);
+    simsycl::set_num_worker_threads(num_threads);
+
+    constexpr size_t num_items = 100'000;
+    int64_t sum = 0;
+    int min = 0;
+    std::array<int64_t, 2> parity_sums{};
+    sycl::queue().parallel_for(sycl::range<1>(num_items), sycl::reduction(&sum, sycl::plus<int64_t>{}),
+        sycl::reduction(&min, 1'000'000, sycl::minimum<int>{}, sycl::property::reduction::initialize_to_identity{}),
+        sycl::reduction(sycl::span<int64_t, 2>(parity_sums), sycl::plus<int64_t>{}),
+        [=](sycl::item<1> item, auto &sum_reducer, auto &min_reducer, auto &parity_reducer) {
+            const auto id = static_cast<int64_t>(item.get_linear_id());
+            sum_reducer += id;
+            min_reducer.combine(static_cast<int>(id) + 7);
+            parity_reducer[id % 2] += id;
+        });
+
+    CHECK(sum == static_cast<int64_t>(num_items * (num_items - 1) / 2));
+    CHECK(min == 7);
+    CHECK(parity_sums[0] + parity_sums[1] == sum);
+    CHECK(parity_sums[1] - parity_sums[0] == static_cast<int64_t>(num_items / 2));
+}
+
+TEST_CASE("deterministic floating-point reductions are independent of the number of threads", "[reduction]") {
+    const auto schedule = GENERATE(values<std::string>({"round_robin", "shuffle", "permutation"}));
+    CAPTURE(schedule);
+    if(schedule == "shuffle") { simsycl::set_cooperative_schedule(std::make_unique<simsycl::shuffle_schedule>()); }
+    if(schedule == "permutation") {
+        simsycl::set_cooperative_schedule(std::make_unique<simsycl::permutation_schedule>());
+    }
+    simsycl::set_deterministic_reductions(true);
+
+    const auto reduce = [](const size_t num_threads) {
+        simsycl::set_num_worker_threads(num_threads);
+        float sum = 0;
+        std::array<double, 2> sums{};
+        sycl::queue().parallel_for(sycl::range<2>(317, 311), sycl::reduction(&sum, sycl::plus<float>{}),
+            sycl::reduction(sycl::span<double, 2>(sums), sycl::plus<double>{}),
+            [=](sycl::item<2> item, auto &sum_reducer, auto &sums_reducer) {
+                const auto id = item.get_linear_id();
+                sum_reducer += 1.0f / static_cast<float>(id + 1);
+                sums_reducer[id % 2] += 1.0 / static_cast<double>(id * id + 1);
+            });
+        return std::tuple(sum, sums[0], sums[1]);
+    };
+
+    const auto serial = reduce(1);
+    for(const size_t num_threads : {2, 3, 8}) {
+        CAPTURE(num_threads);
+        CHECK(reduce(num_threads) == serial);
+    }
+}
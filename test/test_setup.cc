@@ -1,3 +1,4 @@
+#include <simsycl/detail/group_operation_impl.hh>
 #include <simsycl/schedule.hh>
 #include <simsycl/system.hh>
 
@@ -11,6 +12,17 @@ struct global_setup_and_teardown : Catch::EventListenerBase {
     void testCasePartialStarting(const Catch::TestCaseInfo & /* test_info */, uint64_t /* part_number */) override {
         simsycl::configure_system(simsycl::builtin_system);
         simsycl::set_cooperative_schedule(std::make_unique<simsycl::round_robin_schedule>());
+        simsycl::set_num_worker_threads(1);
+        simsycl::set_group_major_resume_order(false);
+        simsycl::set_deterministic_reductions(false);
+        simsycl::set_fiber_budget(std::nullopt);
+        simsycl::set_joint_algorithm_verification(simsycl::joint_algorithm_verification::all_work_items);
+        simsycl::set_atomic_yield_policy(simsycl::atomic_yield_policy::always);
+        simsycl::set_fiber_stack_size(simsycl::default_fiber_stack_size);
+        simsycl::set_fiber_stack_usage_tracking(false);
+        simsycl::set_async_queue_submission(false);
+        // lets tests check the full sequence of group operations, including the ones that have been retired already
+        simsycl::detail::set_group_operation_id_recording(true);
     }
 };
 
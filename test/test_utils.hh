@@ -1,12 +1,26 @@
 #pragma once
 
+#include <simsycl/schedule.hh>
 #include <simsycl/sycl/vec.hh>
 #include <simsycl/system.hh>
 
+#include <memory>
+#include <string>
 #include <tuple>
 
 namespace simsycl::test {
 
+// Create the cooperative schedule of the given name, see REPEAT_FOR_ALL_SCHEDULES.
+inline std::unique_ptr<cooperative_schedule> make_schedule(const std::string &name) {
+    if(name == "shuffle") return std::make_unique<shuffle_schedule>();
+    if(name == "permutation") return std::make_unique<permutation_schedule>();
+    if(name == "morton") return std::make_unique<morton_schedule>();
+    if(name == "tiled") return std::make_unique<tiled_schedule>();
+    // tiles smaller than any range dimension, which do not divide it evenly
+    if(name == "small_tiles") return std::make_unique<tiled_schedule>(7);
+    return std::make_unique<round_robin_schedule>();
+}
+
 template<typename DeviceSetup>
 void configure_device_with(DeviceSetup &&setup_device) {
     auto system = builtin_system;
@@ -38,3 +52,10 @@ class tuple_cross_product {
 };
 
 }; // namespace simsycl::test
+
+// Repeat the remainder of the test case once for each cooperative schedule, whose name is available as `schedule`.
+#define REPEAT_FOR_ALL_SCHEDULES                                                                                       \
+    const std::string schedule = GENERATE(                                                                             \
+        values<std::string>({"round_robin", "shuffle", "permutation", "morton", "tiled", "small_tiles"}));             \
+    CAPTURE(schedule);                                                                                                 \
+    simsycl::set_cooperative_schedule(simsycl::test::make_schedule(schedule));